@@ -0,0 +1,100 @@
+#ifndef THREADSAFESMARTPOINTERS_TS_ACCOUNTING_SCOPE_H
+#define THREADSAFESMARTPOINTERS_TS_ACCOUNTING_SCOPE_H
+
+/**
+ * @file        ts_accounting_scope.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the request-scoped lock accounting.
+ * @date        10/18/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+
+#include <chrono>
+#include <cstdint>
+
+#include "impl/ts_instrumentation.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace ts {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   ts::accounting_scope accumulates the lock acquisitions of the instrumented mutexes
+ *          made by the current thread from the construction of the scope: the count of the
+ *          acquisitions, the time spent waiting for the locks and the time the locks were held.
+ *          The hold time of the lock is accounted on its release. The scopes may be nested,
+ *          each scope reports its own part.
+ *
+ * @details The accounting is thread-local, the threads without the scope are not timed. The
+ *          ts::shared_ptr and ts::unique_ptr mutexes are instrumented if
+ *          THREADSAFESMARTPOINTERS_INSTRUMENT_LOCKS is defined.
+ * @example void handle(const request& req)
+ *          {
+ *              ts::accounting_scope accounting;
+ *              process(req);
+ *              log_request(req, accounting.wait_time(), accounting.hold_time());
+ *          }
+ * @warning The scope should be read and destroyed by the thread which constructed it.
+ */
+class accounting_scope
+{
+public:
+    accounting_scope() noexcept
+        : m_start(impl::accounting_sink::totals())
+    {
+        impl::accounting_sink::enter();
+    }
+
+    ~accounting_scope()
+    {
+        impl::accounting_sink::leave();
+    }
+
+    /**
+     * Prevent copying and moving of an object.
+     */
+    accounting_scope(const accounting_scope&) = delete;
+    accounting_scope(accounting_scope&&) = delete;
+    accounting_scope& operator=(const accounting_scope&) = delete;
+    accounting_scope& operator=(accounting_scope&&) = delete;
+
+    /**
+     * @brief   Gets the count of the lock acquisitions made in the scope.
+     */
+    [[nodiscard]] std::uint64_t acquisition_count() const noexcept
+    {
+        return impl::accounting_sink::totals().m_acquisition_count - m_start.m_acquisition_count;
+    }
+
+    /**
+     * @brief   Gets the time spent waiting for the locks in the scope.
+     */
+    [[nodiscard]] std::chrono::nanoseconds wait_time() const noexcept
+    {
+        return std::chrono::nanoseconds { static_cast<std::chrono::nanoseconds::rep>(
+                impl::accounting_sink::totals().m_wait_ns - m_start.m_wait_ns) };
+    }
+
+    /**
+     * @brief   Gets the time the locks released in the scope were held.
+     */
+    [[nodiscard]] std::chrono::nanoseconds hold_time() const noexcept
+    {
+        return std::chrono::nanoseconds { static_cast<std::chrono::nanoseconds::rep>(
+                impl::accounting_sink::totals().m_hold_ns - m_start.m_hold_ns) };
+    }
+
+private:
+    /**
+     * The totals of the thread at the construction of the scope.
+     */
+    const impl::lock_accounting m_start;
+}; // class accounting_scope
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace ts
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#endif // THREADSAFESMARTPOINTERS_TS_ACCOUNTING_SCOPE_H
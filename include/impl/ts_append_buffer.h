@@ -0,0 +1,333 @@
+#ifndef THREADSAFESMARTPOINTERS_TS_APPEND_BUFFER_H
+#define THREADSAFESMARTPOINTERS_TS_APPEND_BUFFER_H
+
+/**
+ * @file        ts_append_buffer.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the lock-free append-only buffer.
+ * @date        10/18/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+
+#include "impl/ts_config.h"
+#include "impl/ts_epoch.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace ts {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief           ts::append_buffer is the append-only log buffer, the replacement of the
+ *                  ts::shared_ptr<char[]> locked exclusively for every append.
+ *
+ * @details         The writer reserves the space of the record by the single fetch_add on the
+ *                  cursor of the active segment, copies the record without any lock and commits
+ *                  it by the release store to the record header. The reader consumes the
+ *                  committed prefix of the segment, it stops on the first record which is still
+ *                  being written. The full segment rejects the appends until flush() swaps it
+ *                  with the fresh one; the old segment is sealed, its in-flight records are
+ *                  awaited and handed to the flush callback. The swapped out segment is
+ *                  reclaimed through the epoch-based reclamation, so the late writers never
+ *                  touch the freed memory.
+ * @example         ts::append_buffer log { 1 << 20 };
+ *                  if (!log.try_append(std::as_bytes(std::span { line })))
+ *                  {
+ *                      log.flush([&file](std::span<const std::byte> record)
+ *                      {
+ *                          write(file, record);
+ *                      });
+ *                  }
+ */
+class append_buffer
+{
+    using t_word = std::uint64_t;
+
+    /**
+     * The record header is the single word: the payload size above the state bits.
+     */
+    static constexpr t_word s_state_mask = 3;
+    static constexpr t_word s_committed = 1;
+    static constexpr t_word s_end = 2;
+    static constexpr t_word s_discarded = 3;
+    static constexpr std::size_t s_size_shift = 2;
+
+    /**
+     * The bit of the segment cursor set by flush(), the reservations after it are rejected.
+     */
+    static constexpr std::uint64_t s_sealed_bit = std::uint64_t { 1 } << 63;
+
+    /**
+     * @internal
+     * @brief   The segment of the buffer, the records are word aligned and prefixed by the header.
+     *          The zero header is the record which is still being written.
+     */
+    struct segment
+    {
+        explicit segment(std::size_t word_count)
+            : m_word_count(word_count)
+            , m_words(std::make_unique<t_word[]>(word_count))
+        {
+        }
+
+        alignas(impl::config::s_cache_line_size)
+        std::atomic<std::uint64_t> m_cursor { 0 };
+
+        alignas(impl::config::s_cache_line_size)
+        const std::size_t m_word_count;
+        const std::unique_ptr<t_word[]> m_words;
+    };
+
+public:
+    /**
+     * @brief           Constructs the buffer with the given segment capacity.
+     *
+     * @param capacity  The capacity of the segment in bytes, rounded up to the word size. Each
+     *                  record takes the word of the header and its payload rounded up to the word.
+     */
+    explicit append_buffer(std::size_t capacity)
+        : m_word_count(checked_words_of(capacity))
+        , m_p_active(new segment { m_word_count })
+    {
+    }
+
+    /**
+     * Prevent copying and moving of an object.
+     */
+    append_buffer(const append_buffer&) = delete;
+    append_buffer(append_buffer&&) = delete;
+    append_buffer& operator=(const append_buffer&) = delete;
+    append_buffer& operator=(append_buffer&&) = delete;
+
+    /**
+     * @brief   Destroys the active segment. The buffer should not be used concurrently.
+     */
+    ~append_buffer()
+    {
+        delete m_p_active.load(std::memory_order_relaxed);
+    }
+
+public:
+    /**
+     * @brief           Reserves the record and fills it in place by the writer, the record is
+     *                  committed when the writer returns, or discarded if it throws.
+     *
+     * @param size      The size of the record in bytes.
+     * @param writer    The callable which takes the std::span<std::byte> of the record.
+     * @return          false if the active segment has no space for the record.
+     */
+    template <typename TWriter>
+    bool try_append(std::size_t size, TWriter&& writer)
+            requires(std::is_invocable_v<TWriter, std::span<std::byte>>)
+    {
+        const std::size_t word_count = 1 + words_of(size);
+        impl::epoch_domain::guard guard;
+        while (true)
+        {
+            segment* p_segment = m_p_active.load(std::memory_order_acquire);
+            const std::uint64_t cursor = p_segment->m_cursor.fetch_add(word_count
+                    , std::memory_order_acquire);
+            if (0 != (cursor & s_sealed_bit))
+            {
+                // The segment was swapped by flush(), retry with the new one.
+                continue;
+            }
+            if (cursor >= p_segment->m_word_count)
+            {
+                return false;
+            }
+            t_word* p_header = p_segment->m_words.get() + cursor;
+            if (cursor + word_count > p_segment->m_word_count)
+            {
+                // The tail of the segment is left unused, the readers stop on it.
+                publish(p_header, s_end);
+                return false;
+            }
+
+            try
+            {
+                writer(std::span<std::byte> { reinterpret_cast<std::byte*>(p_header + 1), size });
+            }
+            catch (...)
+            {
+                publish(p_header, (size << s_size_shift) | s_discarded);
+                throw;
+            }
+            publish(p_header, (size << s_size_shift) | s_committed);
+            return true;
+        }
+    }
+
+    /**
+     * @brief           Appends the copy of the record.
+     *
+     * @param record    The bytes of the record.
+     * @return          false if the active segment has no space for the record.
+     */
+    bool try_append(std::span<const std::byte> record)
+    {
+        return try_append(record.size(), [record](std::span<std::byte> target)
+        {
+            if (!record.empty())
+            {
+                std::memcpy(target.data(), record.data(), record.size());
+            }
+        });
+    }
+
+    /**
+     * @brief           Visits the committed records of the active segment which were not
+     *                  consumed yet, in the order of the reservation. The consuming stops on the
+     *                  first record which is still being written. The readers are serialized.
+     *
+     * @param reader    The callable which takes the std::span<const std::byte> of the record.
+     * @return          The count of the consumed records.
+     */
+    template <typename TReader>
+    std::size_t consume(TReader&& reader)
+            requires(std::is_invocable_v<TReader, std::span<const std::byte>>)
+    {
+        std::lock_guard lock { m_reader_mtx };
+        segment& active = *m_p_active.load(std::memory_order_acquire);
+        return consume_segment(active, active.m_word_count, reader);
+    }
+
+    /**
+     * @brief           Swaps the active segment with the empty one, awaits the records reserved
+     *                  in the old segment and visits its records which were not consumed yet.
+     *
+     * @param reader    The callable which takes the std::span<const std::byte> of the record.
+     * @return          The count of the consumed records.
+     */
+    template <typename TReader>
+    std::size_t flush(TReader&& reader)
+            requires(std::is_invocable_v<TReader, std::span<const std::byte>>)
+    {
+        std::lock_guard lock { m_reader_mtx };
+        segment* p_old = m_p_active.exchange(new segment { m_word_count }
+                , std::memory_order_acq_rel);
+        const std::uint64_t reserved = p_old->m_cursor.fetch_or(s_sealed_bit
+                , std::memory_order_release);
+        auto retire_old = [this, p_old]()
+        {
+            m_read_cursor = 0;
+            impl::epoch_domain::instance().retire(p_old);
+        };
+        try
+        {
+            const std::size_t count = consume_segment(*p_old
+                    , std::min<std::uint64_t>(reserved, p_old->m_word_count), reader, true);
+            retire_old();
+            return count;
+        }
+        catch (...)
+        {
+            retire_old();
+            throw;
+        }
+    }
+
+    /**
+     * @brief   Gets the capacity of the segment in bytes.
+     */
+    [[nodiscard]] std::size_t capacity() const noexcept
+    {
+        return m_word_count * sizeof(t_word);
+    }
+
+private:
+    static constexpr std::size_t words_of(std::size_t bytes) noexcept
+    {
+        return (bytes + sizeof(t_word) - 1) / sizeof(t_word);
+    }
+
+    static std::size_t checked_words_of(std::size_t bytes)
+    {
+        if (0 == bytes)
+        {
+            if constexpr (impl::config::s_enable_exceptions)
+            {
+                throw std::invalid_argument { "ts::append_buffer capacity should not be zero" };
+            }
+            else
+            {
+                std::terminate();
+            }
+        }
+        return words_of(bytes);
+    }
+
+    static void publish(t_word* p_header, t_word header) noexcept
+    {
+        std::atomic_ref<t_word> { *p_header }.store(header, std::memory_order_release);
+    }
+
+    /**
+     * @internal
+     * @brief   Consumes the records of the segment below the end. If should_wait is true the
+     *          records which are being written are awaited, otherwise the consuming stops on them.
+     */
+    template <typename TReader>
+    std::size_t consume_segment(segment& source, std::size_t end, TReader& reader
+            , bool should_wait = false)
+    {
+        std::size_t count = 0;
+        while (m_read_cursor < end)
+        {
+            t_word* p_header = source.m_words.get() + m_read_cursor;
+            t_word header = std::atomic_ref<t_word> { *p_header }.load(std::memory_order_acquire);
+            while (0 == header && should_wait)
+            {
+                std::this_thread::yield();
+                header = std::atomic_ref<t_word> { *p_header }.load(std::memory_order_acquire);
+            }
+            const t_word state = header & s_state_mask;
+            if (0 == header || s_end == state)
+            {
+                break;
+            }
+            const std::size_t size = header >> s_size_shift;
+            if (s_committed == state)
+            {
+                reader(std::span<const std::byte> {
+                        reinterpret_cast<const std::byte*>(p_header + 1), size });
+                ++count;
+            }
+            m_read_cursor += 1 + words_of(size);
+        }
+        return count;
+    }
+
+private:
+    const std::size_t m_word_count;
+
+    alignas(impl::config::s_cache_line_size)
+    std::atomic<segment*> m_p_active;
+
+    /**
+     * Serializes the readers, guards the read cursor of the active segment.
+     */
+    alignas(impl::config::s_cache_line_size)
+    std::mutex m_reader_mtx {};
+    std::size_t m_read_cursor = 0;
+}; // class append_buffer
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace ts
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#endif // THREADSAFESMARTPOINTERS_TS_APPEND_BUFFER_H
@@ -0,0 +1,220 @@
+#ifndef THREADSAFESMARTPOINTERS_TS_CACHE_LINE_REPORT_H
+#define THREADSAFESMARTPOINTERS_TS_CACHE_LINE_REPORT_H
+
+/**
+ * @file        ts_cache_line_report.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the cache line conflict report.
+ * @date        10/18/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "impl/ts_config.h"
+#include "impl/ts_instrumentation.h"
+#include "impl/ts_mutex.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace ts {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief           Names the instrumented mutex for the diagnostic reports. The named mutex is
+ *                  reported even if it was not contended yet.
+ *
+ * @example         ts::unique_ptr<order_book, ts::instrumented_mutex<>> p_orders { ... };
+ *                  ts::set_lock_name(p_orders, "orders");
+ * @tparam TLockable The type of ts::instrumented_mutex, or ts::shared_ptr and ts::unique_ptr with
+ *                  ts::instrumented_mutex.
+ * @param lockable  The mutex or the pointer.
+ * @param name      The name of the mutex.
+ */
+template <typename TLockable>
+void set_lock_name(const TLockable& lockable, std::string name)
+        requires(impl::is_instrumented_lockable<TLockable>)
+{
+    mutex_diagnostics_of(lockable).set_name(std::move(name));
+}
+
+/**
+ * @brief   ts::contention_monitor counts the contended acquisitions of all instrumented mutexes
+ *          from the construction until the destruction, the counts are accumulated by the
+ *          mutexes for ts::cache_line_report. The monitors may be nested.
+ *
+ * @example ts::contention_monitor monitor;
+ *          run_workload();
+ *          std::cerr << ts::cache_line_report::collect() << std::endl;
+ */
+class contention_monitor
+{
+public:
+    contention_monitor() noexcept
+    {
+        impl::contention_sink::instance().start();
+    }
+
+    ~contention_monitor()
+    {
+        impl::contention_sink::instance().stop();
+    }
+
+    /**
+     * Prevent copying and moving of an object.
+     */
+    contention_monitor(const contention_monitor&) = delete;
+    contention_monitor(contention_monitor&&) = delete;
+    contention_monitor& operator=(const contention_monitor&) = delete;
+    contention_monitor& operator=(contention_monitor&&) = delete;
+}; // class contention_monitor
+
+/**
+ * @brief   The contended mutex of the cache line.
+ */
+struct cache_line_mutex
+{
+    /**
+     * The name given by ts::set_lock_name, or empty.
+     */
+    std::string m_name {};
+
+    std::uintptr_t m_address = 0;
+    std::uint64_t m_contention_count = 0;
+};
+
+/**
+ * @brief   The cache line shared by the several contended mutexes, ordered by the address.
+ */
+struct cache_line_conflict
+{
+    std::uintptr_t m_line_address = 0;
+    std::vector<cache_line_mutex> m_mutexes {};
+};
+
+/**
+ * @brief   ts::cache_line_report groups the contended instrumented mutexes by the cache line and
+ *          reports the lines where the several contended mutexes are co-located, e.g. the
+ *          members of the same struct or the adjacent allocations. Such mutexes are slowed
+ *          down by the false sharing even if they protect the independent objects.
+ *
+ * @example ts::set_lock_name(p_orders, "orders");
+ *          ts::set_lock_name(p_stats, "stats");
+ *          ts::contention_monitor monitor;
+ *          run_workload();
+ *          std::cerr << ts::cache_line_report::collect().summary() << std::endl;
+ */
+class cache_line_report
+{
+public:
+    cache_line_report() = default;
+
+    explicit cache_line_report(std::vector<cache_line_conflict> conflicts) noexcept
+        : m_conflicts(std::move(conflicts))
+    {
+    }
+
+    /**
+     * @brief   Collects the conflicts of the live instrumented mutexes, the contention counts are
+     *          accumulated from the construction of the mutex while any ts::contention_monitor
+     *          was alive.
+     */
+    static cache_line_report collect()
+    {
+        std::map<std::uintptr_t, std::vector<cache_line_mutex>> lines;
+        for (auto& entry : impl::mutex_registry::instance().entries())
+        {
+            if (0 == entry.m_contention_count)
+            {
+                continue;
+            }
+            lines[entry.m_address / impl::config::s_cache_line_size].push_back(
+                    cache_line_mutex { std::move(entry.m_name), entry.m_address
+                            , entry.m_contention_count });
+        }
+
+        std::vector<cache_line_conflict> conflicts;
+        for (auto& [line, mutexes] : lines)
+        {
+            if (mutexes.size() < 2)
+            {
+                continue;
+            }
+            std::ranges::sort(mutexes, {}, &cache_line_mutex::m_address);
+            conflicts.push_back(cache_line_conflict {
+                    line * impl::config::s_cache_line_size, std::move(mutexes) });
+        }
+        return cache_line_report { std::move(conflicts) };
+    }
+
+    [[nodiscard]] const std::vector<cache_line_conflict>& conflicts() const noexcept
+    {
+        return m_conflicts;
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return m_conflicts.empty();
+    }
+
+    /**
+     * @brief   Gets the one-line diagnostic, e.g.
+     *          "1 cache line conflict: 0x7f3a1c000040 [orders x120, stats x98]".
+     */
+    [[nodiscard]] std::string summary() const
+    {
+        std::ostringstream stream;
+        stream << *this;
+        return stream.str();
+    }
+
+    friend std::ostream& operator<<(std::ostream& out, const cache_line_report& report)
+    {
+        const auto& conflicts = report.m_conflicts;
+        if (conflicts.empty())
+        {
+            return out << "no cache line conflicts";
+        }
+        out << conflicts.size() << (1 == conflicts.size()
+                ? " cache line conflict: "
+                : " cache line conflicts: ");
+        for (std::size_t i = 0; i < conflicts.size(); ++i)
+        {
+            out << (0 == i ? "" : "; ") << "0x" << std::hex << conflicts[i].m_line_address
+                    << std::dec << " [";
+            const auto& mutexes = conflicts[i].m_mutexes;
+            for (std::size_t j = 0; j < mutexes.size(); ++j)
+            {
+                out << (0 == j ? "" : ", ");
+                if (mutexes[j].m_name.empty())
+                {
+                    out << "0x" << std::hex << mutexes[j].m_address << std::dec;
+                }
+                else
+                {
+                    out << mutexes[j].m_name;
+                }
+                out << " x" << mutexes[j].m_contention_count;
+            }
+            out << "]";
+        }
+        return out;
+    }
+
+private:
+    std::vector<cache_line_conflict> m_conflicts {};
+}; // class cache_line_report
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace ts
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#endif // THREADSAFESMARTPOINTERS_TS_CACHE_LINE_REPORT_H
@@ -0,0 +1,424 @@
+#ifndef THREADSAFESMARTPOINTERS_TS_CONCURRENT_LRU_H
+#define THREADSAFESMARTPOINTERS_TS_CONCURRENT_LRU_H
+
+/**
+ * @file        ts_concurrent_lru.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of sharded concurrent cache with CLOCK eviction.
+ * @date        10/18/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "impl/ts_config.h"
+#include "impl/ts_shared_ptr.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace ts {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief           ts::concurrent_lru is a sharded cache with the approximated LRU eviction
+ *                  (CLOCK), the replacement of the LRU cache guarded by single ts::shared_ptr.
+ *
+ * @details         The keys are distributed between N shards, each shard has its own capacity
+ *                  and is guarded by its own ts::shared_ptr. The hit does not reorder any list,
+ *                  it only sets the reference bit of the entry, so the lookups take the read
+ *                  lock through the read-only ts::shared_ptr<const shard> and scale with the
+ *                  readers. The insert into the full shard takes the write lock and moves the
+ *                  clock hand, clearing the reference bits, until it finds the entry which was
+ *                  not referenced since the last pass.
+ * @example         ts::concurrent_lru<std::string, int> cache { 1024 };
+ *                  cache.put("key", 13);
+ *                  if (auto val = cache.get("key"))
+ *                  {
+ *                      process(*val);
+ *                  }
+ * @tparam TKey     The type of the keys.
+ * @tparam TValue   The type of the values.
+ * @tparam THash    The hash function object type (optional by default std::hash<TKey>).
+ * @tparam TMutex   The type of mutex of the shards (optional by default std::shared_mutex).
+ */
+template <typename TKey
+        , typename TValue
+        , typename THash = std::hash<TKey>
+        , typename TMutex = std::shared_mutex>
+class concurrent_lru
+{
+    /**
+     * @internal
+     * @brief   The cache entry, the reference bit could be set under the read lock.
+     */
+    struct entry
+    {
+        entry(TKey key, TValue value)
+            : m_key(std::move(key))
+            , m_value(std::move(value))
+        {
+        }
+
+        entry(entry&& other) noexcept
+            : m_key(std::move(other.m_key))
+            , m_value(std::move(other.m_value))
+            , m_referenced(other.m_referenced.load(std::memory_order_relaxed))
+        {
+        }
+
+        entry& operator=(entry&& other) noexcept
+        {
+            m_key = std::move(other.m_key);
+            m_value = std::move(other.m_value);
+            m_referenced.store(other.m_referenced.load(std::memory_order_relaxed)
+                    , std::memory_order_relaxed);
+            return *this;
+        }
+
+        entry(const entry&) = delete;
+        entry& operator=(const entry&) = delete;
+        ~entry() = default;
+
+        TKey m_key;
+        TValue m_value;
+        mutable std::atomic_bool m_referenced { false };
+    };
+
+    /**
+     * @internal
+     * @brief   The shard of the cache, the entries are stored in the clock ring.
+     */
+    class shard
+    {
+    public:
+        explicit shard(std::size_t capacity)
+            : m_capacity(capacity)
+        {
+            m_entries.reserve(capacity);
+            m_index.reserve(capacity);
+        }
+
+        /**
+         * @brief   Finds the entry and marks it as referenced. Requires the read lock.
+         */
+        const entry* find(const TKey& key) const
+        {
+            const auto it = m_index.find(key);
+            if (it == m_index.end())
+            {
+                return nullptr;
+            }
+            const entry& found = m_entries[it->second];
+            if (!found.m_referenced.load(std::memory_order_relaxed))
+            {
+                found.m_referenced.store(true, std::memory_order_relaxed);
+            }
+            return &found;
+        }
+
+        /**
+         * @brief   Inserts or replaces the entry, evicts the not referenced entry if the shard
+         *          is full. Requires the write lock.
+         */
+        void put(TKey key, TValue value)
+        {
+            if (const auto it = m_index.find(key); it != m_index.end())
+            {
+                entry& found = m_entries[it->second];
+                found.m_value = std::move(value);
+                found.m_referenced.store(true, std::memory_order_relaxed);
+                return;
+            }
+            if (m_entries.size() < m_capacity)
+            {
+                m_index.emplace(key, m_entries.size());
+                m_entries.emplace_back(std::move(key), std::move(value));
+                return;
+            }
+            const std::size_t victim = advance_clock();
+            m_index.erase(m_entries[victim].m_key);
+            m_index.emplace(key, victim);
+            m_entries[victim] = entry { std::move(key), std::move(value) };
+        }
+
+        /**
+         * @brief   Removes the entry. Requires the write lock.
+         */
+        bool erase(const TKey& key)
+        {
+            const auto it = m_index.find(key);
+            if (it == m_index.end())
+            {
+                return false;
+            }
+            const std::size_t position = it->second;
+            m_index.erase(it);
+            if (position + 1 != m_entries.size())
+            {
+                m_entries[position] = std::move(m_entries.back());
+                m_index[m_entries[position].m_key] = position;
+            }
+            m_entries.pop_back();
+            if (m_hand >= m_entries.size())
+            {
+                m_hand = 0;
+            }
+            return true;
+        }
+
+        void clear()
+        {
+            m_index.clear();
+            m_entries.clear();
+            m_hand = 0;
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return m_entries.size();
+        }
+
+    private:
+        /**
+         * @brief   Moves the clock hand to the first not referenced entry, clears the reference
+         *          bits on the way.
+         *
+         * @return  The position of the victim.
+         */
+        std::size_t advance_clock()
+        {
+            while (m_entries[m_hand].m_referenced.exchange(false, std::memory_order_relaxed))
+            {
+                m_hand = (m_hand + 1) % m_entries.size();
+            }
+            const std::size_t victim = m_hand;
+            m_hand = (m_hand + 1) % m_entries.size();
+            return victim;
+        }
+
+        const std::size_t m_capacity;
+        std::vector<entry> m_entries {};
+        std::unordered_map<TKey, std::size_t, THash> m_index {};
+        std::size_t m_hand = 0;
+    };
+
+    using t_shard_ptr = shared_ptr<shard, TMutex>;
+    using t_shard_view = shared_ptr<const shard, TMutex>;
+
+    /**
+     * @internal
+     * @brief   The shard pointers padded to the cache line to avoid false sharing between the
+     *          locks. The read-only view shares the mutex with the writable pointer.
+     */
+    struct alignas(impl::config::s_cache_line_size) shard_slot
+    {
+        explicit shard_slot(std::size_t capacity)
+            : m_shard(new shard { capacity })
+            , m_view(m_shard)
+        {
+        }
+
+        t_shard_ptr m_shard;
+        t_shard_view m_view;
+    };
+
+    /**
+     * The default count of the shards per thread.
+     */
+    static constexpr std::size_t s_shards_per_thread = 4;
+
+public:
+    using key_type = TKey;
+    using mapped_type = TValue;
+    using size_type = std::size_t;
+    using hasher = THash;
+    using mutex_type = TMutex;
+
+public:
+    /**
+     * @brief               Constructs the empty cache, the capacity is distributed between the
+     *                      shards equally.
+     *
+     * @param capacity      The maximal count of the entries, should be greater than zero.
+     * @param shard_count   The count of the shards (optional by default based on the hardware
+     *                      concurrency).
+     * @param hash          The hash function object.
+     */
+    explicit concurrent_lru(size_type capacity
+            , size_type shard_count
+                    = s_shards_per_thread * std::max(1u, std::thread::hardware_concurrency())
+            , const hasher& hash = hasher {})
+        : m_hash(hash)
+    {
+        shard_count = std::clamp<size_type>(shard_count, 1, std::max<size_type>(1, capacity));
+        m_shard_capacity = std::max<size_type>(1, (capacity + shard_count - 1) / shard_count);
+        m_shards.reserve(shard_count);
+        for (size_type i = 0; i < shard_count; ++i)
+        {
+            m_shards.emplace_back(m_shard_capacity);
+        }
+    }
+
+    /**
+     * Prevent copying and moving of an object.
+     */
+    concurrent_lru(const concurrent_lru&) = delete;
+    concurrent_lru(concurrent_lru&&) = delete;
+    concurrent_lru& operator=(const concurrent_lru&) = delete;
+    concurrent_lru& operator=(concurrent_lru&&) = delete;
+
+    ~concurrent_lru() = default;
+
+public:
+    /**
+     * @brief       Finds the value by the key and marks the entry as recently used.
+     *              Takes only the read lock of the shard.
+     *
+     * @param key   The key to find.
+     * @return      The copy of the value or empty if the key is not cached.
+     */
+    std::optional<mapped_type> get(const key_type& key) const
+    {
+        const t_shard_view& view = shard_for(key).m_view;
+        impl::t_read_lock<const t_shard_view> lock { view };
+        if (const entry* p_entry = view.get()->find(key))
+        {
+            return p_entry->m_value;
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief       Checks the key is cached, marks the entry as recently used.
+     *              Takes only the read lock of the shard.
+     *
+     * @param key   The key to find.
+     * @return      true if the key is cached, otherwise false.
+     */
+    [[nodiscard]] bool contains(const key_type& key) const
+    {
+        const t_shard_view& view = shard_for(key).m_view;
+        impl::t_read_lock<const t_shard_view> lock { view };
+        return nullptr != view.get()->find(key);
+    }
+
+    /**
+     * @brief       Inserts the value or replaces the value of the existing key. If the shard is
+     *              full the entry which was not used since the last clock pass is evicted.
+     *
+     * @param key   The key.
+     * @param value The value.
+     */
+    void put(key_type key, mapped_type value)
+    {
+        shard_for(key).m_shard->put(std::move(key), std::move(value));
+    }
+
+    /**
+     * @brief       Removes the key from the cache.
+     *
+     * @param key   The key to remove.
+     * @return      true if the key was removed, otherwise false.
+     */
+    bool erase(const key_type& key)
+    {
+        return shard_for(key).m_shard->erase(key);
+    }
+
+    /**
+     * @brief   Removes all entries.
+     */
+    void clear()
+    {
+        for (shard_slot& slot : m_shards)
+        {
+            slot.m_shard->clear();
+        }
+    }
+
+    /**
+     * @brief   Gets the count of the cached entries, the value may be outdated under
+     *          concurrent modifications.
+     *
+     * @return  The count of entries.
+     */
+    [[nodiscard]] size_type size() const
+    {
+        size_type result = 0;
+        for (const shard_slot& slot : m_shards)
+        {
+            result += slot.m_view->size();
+        }
+        return result;
+    }
+
+    /**
+     * @brief   Gets the maximal count of the entries.
+     *
+     * @return  The capacity.
+     */
+    [[nodiscard]] size_type capacity() const noexcept
+    {
+        return m_shard_capacity * m_shards.size();
+    }
+
+    /**
+     * @brief   Gets the count of the shards.
+     *
+     * @return  The shard count.
+     */
+    [[nodiscard]] size_type shard_count() const noexcept
+    {
+        return m_shards.size();
+    }
+
+    /**
+     * @brief   Gets the maximal count of the entries in the single shard.
+     *
+     * @return  The shard capacity.
+     */
+    [[nodiscard]] size_type shard_capacity() const noexcept
+    {
+        return m_shard_capacity;
+    }
+
+private:
+    /**
+     * @internal
+     * @brief   Chooses the shard of the key, the hash is mixed to not depend on the low bits
+     *          of the identity hashes.
+     */
+    const shard_slot& shard_for(const key_type& key) const
+    {
+        const auto hash = static_cast<std::uint64_t>(m_hash(key)) * 0x9E3779B97F4A7C15ull;
+        return m_shards[static_cast<size_type>(hash >> 32) % m_shards.size()];
+    }
+
+    shard_slot& shard_for(const key_type& key)
+    {
+        return const_cast<shard_slot&>(std::as_const(*this).shard_for(key));
+    }
+
+private:
+    std::vector<shard_slot> m_shards {};
+    size_type m_shard_capacity = 0;
+    [[no_unique_address]] hasher m_hash;
+}; // class concurrent_lru
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace ts
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#endif // THREADSAFESMARTPOINTERS_TS_CONCURRENT_LRU_H
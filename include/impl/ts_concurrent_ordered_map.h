@@ -0,0 +1,545 @@
+#ifndef THREADSAFESMARTPOINTERS_TS_CONCURRENT_ORDERED_MAP_H
+#define THREADSAFESMARTPOINTERS_TS_CONCURRENT_ORDERED_MAP_H
+
+/**
+ * @file        ts_concurrent_ordered_map.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of lock-free ordered map based on skiplist.
+ * @date        10/18/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <optional>
+#include <unordered_set>
+#include <utility>
+
+#include "impl/ts_epoch.h"
+#include "impl/ts_random.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace ts {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief           ts::concurrent_ordered_map is a lock-free ordered associative container
+ *                  implemented as a skiplist.
+ *
+ * @details         Lookups, insertions, erasures and forward range scans are lock-free and run
+ *                  concurrently. The erased node is marked first (logical deletion), then
+ *                  unlinked from all levels by the traversing threads. The unlinked nodes are
+ *                  reclaimed using the epoch-based reclamation, so the readers never touch a
+ *                  freed memory.
+ *                  The key and the value of the node are immutable after the insertion, use
+ *                  erase and insert to replace the value.
+ * @example         ts::concurrent_ordered_map<int, std::string> map;
+ *                  map.insert(1, "one");
+ *                  if (auto val = map.find(1))
+ *                  {
+ *                      std::cout << *val;
+ *                  }
+ *                  map.range_scan(0, 10, [](const int& key, const std::string& val) { ... });
+ * @warning         The range scans are weakly consistent, the elements inserted or erased
+ *                  during the scan may or may not be visited.
+ * @tparam TKey     The type of the keys.
+ * @tparam TValue   The type of the mapped values.
+ * @tparam TCompare The keys comparison function object type (optional by default std::less).
+ */
+template <typename TKey, typename TValue, typename TCompare = std::less<TKey>>
+class concurrent_ordered_map
+{
+public:
+    using key_type = TKey;
+    using mapped_type = TValue;
+    using key_compare = TCompare;
+    using size_type = std::size_t;
+
+private:
+    /**
+     * The maximal height of the skiplist towers.
+     */
+    static constexpr int32_t s_max_level = 24;
+
+    /**
+     * The mark bit of the link shows the node is logically deleted.
+     */
+    static constexpr std::uintptr_t s_mark_bit = 1;
+
+    using t_link = std::atomic<std::uintptr_t>;
+
+    /**
+     * @internal
+     * @brief   The skiplist node, the links array is allocated just after the node.
+     */
+    struct alignas(t_link) node
+    {
+        template <typename TK, typename TV>
+        node(int32_t level, TK&& key, TV&& value)
+            : m_key(std::forward<TK>(key))
+            , m_value(std::forward<TV>(value))
+            , m_level(level)
+        {
+            for (int32_t i = 0; i < m_level; ++i)
+            {
+                ::new (static_cast<void*>(links() + i)) t_link { 0 };
+            }
+        }
+
+        t_link* links() noexcept
+        {
+            return reinterpret_cast<t_link*>(this + 1);
+        }
+
+        const key_type m_key;
+        const mapped_type m_value;
+
+        /**
+         * The count of the levels where the node is linked plus one reference of the
+         * inserting thread. The node is retired when it drops to zero.
+         */
+        std::atomic<int32_t> m_refs { 1 };
+        const int32_t m_level;
+    };
+
+    using t_nodes = std::array<node*, s_max_level>;
+
+public:
+    concurrent_ordered_map() = default;
+
+    /**
+     * @brief       Constructs the empty map with the given comparator.
+     *
+     * @param comp  The comparison function object.
+     */
+    explicit concurrent_ordered_map(const key_compare& comp)
+        : m_compare(comp)
+    {
+    }
+
+    /**
+     * @brief       Destroys all nodes.
+     *
+     * @warning     The destructor is not thread-safe, no other thread should access the map.
+     */
+    ~concurrent_ordered_map()
+    {
+        std::unordered_set<node*> nodes;
+        for (int32_t level = 0; level < s_max_level; ++level)
+        {
+            for (node* p = pointer(m_head[level].load()); nullptr != p
+                    ; p = pointer(p->links()[level].load()))
+            {
+                nodes.insert(p);
+            }
+        }
+        std::ranges::for_each(nodes, &destroy_node);
+    }
+
+    /**
+     * Prevent copying and moving of an object.
+     */
+    concurrent_ordered_map(const concurrent_ordered_map&) = delete;
+    concurrent_ordered_map(concurrent_ordered_map&&) = delete;
+    concurrent_ordered_map& operator=(const concurrent_ordered_map&) = delete;
+    concurrent_ordered_map& operator=(concurrent_ordered_map&&) = delete;
+
+public:
+    /**
+     * @brief           Inserts the element if the map doesn't contain an element with
+     *                  equivalent key.
+     *
+     * @tparam TK       The key type, should be convertible to key_type.
+     * @tparam TV       The value type, should be convertible to mapped_type.
+     * @param key       The key of the element.
+     * @param value     The value of the element.
+     * @return          true if the element was inserted, otherwise false.
+     */
+    template <typename TK, typename TV>
+    bool insert(TK&& key, TV&& value)
+    {
+        impl::epoch_domain::guard guard;
+        t_nodes preds {};
+        t_nodes succs {};
+        node* p_new = create_node(random_level(), std::forward<TK>(key), std::forward<TV>(value));
+        while (true)
+        {
+            if (find_position(p_new->m_key, preds, succs))
+            {
+                destroy_node(p_new);
+                return false;
+            }
+            for (int32_t level = 0; level < p_new->m_level; ++level)
+            {
+                const auto index = static_cast<std::size_t>(level);
+                p_new->links()[level].store(to_link(succs[index]), std::memory_order_relaxed);
+            }
+            p_new->m_refs.fetch_add(1, std::memory_order_relaxed);
+            std::uintptr_t expected = to_link(succs[0]);
+            if (links_of(preds[0])[0].compare_exchange_strong(expected, to_link(p_new)
+                    , std::memory_order_acq_rel, std::memory_order_relaxed))
+            {
+                break;
+            }
+            p_new->m_refs.fetch_sub(1, std::memory_order_relaxed);
+        }
+        m_size.fetch_add(1, std::memory_order_relaxed);
+
+        link_upper_levels(p_new, preds, succs);
+        if (is_marked(p_new->links()[0].load(std::memory_order_acquire)))
+        {
+            (void) find_position(p_new->m_key, preds, succs);
+        }
+        release_reference(p_new);
+        return true;
+    }
+
+    /**
+     * @brief       Erases the element with the given key.
+     *
+     * @param key   The key of the element to erase.
+     * @return      true if the element was erased by this call, otherwise false.
+     */
+    bool erase(const key_type& key)
+    {
+        impl::epoch_domain::guard guard;
+        t_nodes preds {};
+        t_nodes succs {};
+        if (!find_position(key, preds, succs))
+        {
+            return false;
+        }
+        node* p_victim = succs[0];
+        // The unsigned top-down count, the upper levels are marked before the bottom one.
+        for (auto level = static_cast<std::size_t>(p_victim->m_level); level-- > 1;)
+        {
+            std::uintptr_t link = p_victim->links()[level].load(std::memory_order_acquire);
+            while (!is_marked(link) && !p_victim->links()[level].compare_exchange_weak(link
+                    , link | s_mark_bit, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+            }
+        }
+        std::uintptr_t link = p_victim->links()[0].load(std::memory_order_acquire);
+        while (!is_marked(link))
+        {
+            if (p_victim->links()[0].compare_exchange_weak(link, link | s_mark_bit
+                    , std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                m_size.fetch_sub(1, std::memory_order_relaxed);
+                (void) find_position(key, preds, succs);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief       Finds the element with the given key.
+     *
+     * @param key   The key of the element to search.
+     * @return      The copy of the mapped value if the element is found, otherwise empty.
+     */
+    [[nodiscard]] std::optional<mapped_type> find(const key_type& key) const
+    {
+        impl::epoch_domain::guard guard;
+        node* p_node = lower_bound(key);
+        if (nullptr != p_node && !m_compare(key, p_node->m_key)
+                && !is_marked(p_node->links()[0].load(std::memory_order_acquire)))
+        {
+            return p_node->m_value;
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief       Checks the map contains the element with the given key.
+     *
+     * @param key   The key of the element to search.
+     * @return      true if the element is found, otherwise false.
+     */
+    [[nodiscard]] bool contains(const key_type& key) const
+    {
+        impl::epoch_domain::guard guard;
+        node* p_node = lower_bound(key);
+        return nullptr != p_node && !m_compare(key, p_node->m_key)
+                && !is_marked(p_node->links()[0].load(std::memory_order_acquire));
+    }
+
+    /**
+     * @brief           Visits the elements with the keys in the range [first, last) in the
+     *                  ascending order. The scan doesn't block any operation.
+     *
+     * @tparam TFunc    The function type, should be invocable with
+     *                  (const key_type&, const mapped_type&).
+     * @param first     The first key of the range.
+     * @param last      The key after the range end.
+     * @param func      The function object.
+     */
+    template <typename TFunc>
+    void range_scan(const key_type& first, const key_type& last, TFunc&& func) const
+    {
+        impl::epoch_domain::guard guard;
+        for (node* p = lower_bound(first); nullptr != p && m_compare(p->m_key, last)
+                ; p = pointer(p->links()[0].load(std::memory_order_acquire)))
+        {
+            if (!is_marked(p->links()[0].load(std::memory_order_acquire)))
+            {
+                func(p->m_key, p->m_value);
+            }
+        }
+    }
+
+    /**
+     * @brief           Visits all elements in the ascending order of the keys.
+     *
+     * @tparam TFunc    The function type, should be invocable with
+     *                  (const key_type&, const mapped_type&).
+     * @param func      The function object.
+     */
+    template <typename TFunc>
+    void for_each(TFunc&& func) const
+    {
+        impl::epoch_domain::guard guard;
+        for (node* p = pointer(m_head[0].load(std::memory_order_acquire)); nullptr != p
+                ; p = pointer(p->links()[0].load(std::memory_order_acquire)))
+        {
+            if (!is_marked(p->links()[0].load(std::memory_order_acquire)))
+            {
+                func(p->m_key, p->m_value);
+            }
+        }
+    }
+
+    /**
+     * @brief   Gets the count of the elements, the value may be outdated under concurrent
+     *          modifications.
+     *
+     * @return  The map size.
+     */
+    [[nodiscard]] size_type size() const noexcept
+    {
+        return m_size.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief   Checks the map has no elements.
+     *
+     * @return  true if the map is empty, otherwise false.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return 0 == size();
+    }
+
+private:
+    /**
+     * @internal
+     * @brief       Searches the predecessors and successors of the key on all levels and
+     *              unlinks the marked nodes on the way.
+     *
+     * @return      true if the unmarked node with equivalent key is found.
+     */
+    bool find_position(const key_type& key, t_nodes& preds, t_nodes& succs)
+    {
+        while (true)
+        {
+            if (try_find_position(key, preds, succs))
+            {
+                return nullptr != succs[0] && !m_compare(key, succs[0]->m_key);
+            }
+        }
+    }
+
+    /**
+     * @internal
+     * @brief       The single attempt of find_position.
+     *
+     * @return      false if the unlinking failed and search should be restarted.
+     */
+    bool try_find_position(const key_type& key, t_nodes& preds, t_nodes& succs)
+    {
+        node* p_pred = nullptr;
+        for (int32_t level = s_max_level - 1; level >= 0; --level)
+        {
+            node* p_curr = pointer(links_of(p_pred)[level].load(std::memory_order_acquire));
+            while (nullptr != p_curr)
+            {
+                std::uintptr_t succ = p_curr->links()[level].load(std::memory_order_acquire);
+                while (is_marked(succ))
+                {
+                    std::uintptr_t expected = to_link(p_curr);
+                    if (!links_of(p_pred)[level].compare_exchange_strong(expected
+                            , succ & ~s_mark_bit, std::memory_order_acq_rel
+                            , std::memory_order_relaxed))
+                    {
+                        return false;
+                    }
+                    release_reference(p_curr);
+                    p_curr = pointer(succ);
+                    if (nullptr == p_curr)
+                    {
+                        break;
+                    }
+                    succ = p_curr->links()[level].load(std::memory_order_acquire);
+                }
+                if (nullptr == p_curr || !m_compare(p_curr->m_key, key))
+                {
+                    break;
+                }
+                p_pred = p_curr;
+                p_curr = pointer(succ);
+            }
+            preds[static_cast<std::size_t>(level)] = p_pred;
+            succs[static_cast<std::size_t>(level)] = p_curr;
+        }
+        return true;
+    }
+
+    /**
+     * @internal
+     * @brief       Links the inserted node on the levels above the bottom one. Stops if the
+     *              node is erased concurrently.
+     */
+    void link_upper_levels(node* p_new, t_nodes& preds, t_nodes& succs)
+    {
+        for (int32_t level = 1; level < p_new->m_level; ++level)
+        {
+            const auto index = static_cast<std::size_t>(level);
+            while (true)
+            {
+                std::uintptr_t link = p_new->links()[level].load(std::memory_order_acquire);
+                if (is_marked(link))
+                {
+                    return;
+                }
+                if (link != to_link(succs[index])
+                        && !p_new->links()[level].compare_exchange_strong(link
+                                , to_link(succs[index]), std::memory_order_acq_rel
+                                , std::memory_order_acquire))
+                {
+                    continue;
+                }
+                p_new->m_refs.fetch_add(1, std::memory_order_relaxed);
+                std::uintptr_t expected = to_link(succs[index]);
+                if (links_of(preds[index])[level].compare_exchange_strong(expected
+                        , to_link(p_new), std::memory_order_acq_rel, std::memory_order_relaxed))
+                {
+                    break;
+                }
+                p_new->m_refs.fetch_sub(1, std::memory_order_relaxed);
+                if (!find_position(p_new->m_key, preds, succs) || succs[0] != p_new)
+                {
+                    return;
+                }
+            }
+        }
+    }
+
+    /**
+     * @internal
+     * @brief       Finds the first node with the key not less than the given one without
+     *              modifying the list.
+     */
+    node* lower_bound(const key_type& key) const
+    {
+        node* p_pred = nullptr;
+        node* p_curr = nullptr;
+        for (int32_t level = s_max_level - 1; level >= 0; --level)
+        {
+            p_curr = pointer(links_of(p_pred)[level].load(std::memory_order_acquire));
+            while (nullptr != p_curr && m_compare(p_curr->m_key, key))
+            {
+                p_pred = p_curr;
+                p_curr = pointer(p_curr->links()[level].load(std::memory_order_acquire));
+            }
+        }
+        return p_curr;
+    }
+
+    /**
+     * @internal
+     * @brief       Drops one reference of the node, retires the unreachable node.
+     */
+    static void release_reference(node* p_node)
+    {
+        if (1 == p_node->m_refs.fetch_sub(1, std::memory_order_acq_rel))
+        {
+            impl::epoch_domain::instance().retire(p_node, &destroy_node);
+        }
+    }
+
+    t_link* links_of(node* p_node) const noexcept
+    {
+        return nullptr == p_node ? m_head.data() : p_node->links();
+    }
+
+    template <typename TK, typename TV>
+    static node* create_node(int32_t level, TK&& key, TV&& value)
+    {
+        void* p_memory = ::operator new(sizeof(node)
+                + sizeof(t_link) * static_cast<std::size_t>(level));
+        try
+        {
+            return ::new (p_memory) node(level, std::forward<TK>(key), std::forward<TV>(value));
+        }
+        catch (...)
+        {
+            ::operator delete(p_memory);
+            throw;
+        }
+    }
+
+    static void destroy_node(void* p_memory)
+    {
+        std::destroy_at(static_cast<node*>(p_memory));
+        ::operator delete(p_memory);
+    }
+
+    static int32_t random_level() noexcept
+    {
+        return 1 + std::min(std::countr_zero(impl::thread_local_random()), s_max_level - 1);
+    }
+
+    static node* pointer(std::uintptr_t link) noexcept
+    {
+        return reinterpret_cast<node*>(link & ~s_mark_bit);
+    }
+
+    static std::uintptr_t to_link(node* p_node) noexcept
+    {
+        return reinterpret_cast<std::uintptr_t>(p_node);
+    }
+
+    static bool is_marked(std::uintptr_t link) noexcept
+    {
+        return 0 != (link & s_mark_bit);
+    }
+
+private:
+    /**
+     * The links of the head tower.
+     */
+    mutable std::array<t_link, s_max_level> m_head {};
+
+    /**
+     * The approximate count of the elements.
+     */
+    std::atomic<size_type> m_size { 0 };
+
+    [[no_unique_address]] key_compare m_compare {};
+}; // class concurrent_ordered_map
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace ts
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#endif // THREADSAFESMARTPOINTERS_TS_CONCURRENT_ORDERED_MAP_H
@@ -0,0 +1,358 @@
+#ifndef THREADSAFESMARTPOINTERS_TS_CONCURRENT_STACK_H
+#define THREADSAFESMARTPOINTERS_TS_CONCURRENT_STACK_H
+
+/**
+ * @file        ts_concurrent_stack.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of lock-free concurrent stack.
+ * @date        10/18/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "impl/ts_config.h"
+#include "impl/ts_epoch.h"
+#include "impl/ts_random.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace ts {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief           ts::concurrent_stack is a lock-free LIFO stack (Treiber stack), the
+ *                  replacement of the std::stack guarded by ts::shared_ptr.
+ *
+ * @details         The stack is the singly linked list with the atomic head. The removed nodes
+ *                  are reclaimed through the epoch-based reclamation, the node could not be
+ *                  reused while any thread may still read it, which prevents the ABA problem.
+ *                  When the CAS on the head fails because of contention, the thread tries the
+ *                  elimination array: the concurrent push and pop meet in the random slot and
+ *                  exchange the element without touching the head.
+ * @example         ts::concurrent_stack<int> stack;
+ *                  stack.push(13);
+ *                  stack.push_range(values.begin(), values.end());
+ *                  if (auto val = stack.try_pop())
+ *                  {
+ *                      process(*val);
+ *                  }
+ *                  for (int val : stack.pop_all())
+ *                  {
+ *                      process(val);
+ *                  }
+ * @tparam T        The type of the elements.
+ */
+template <typename T>
+class concurrent_stack
+{
+    /**
+     * @internal
+     * @brief   The stack node.
+     */
+    struct node
+    {
+        template <typename... TArgs>
+        explicit node(TArgs&&... args)
+            : m_value(std::forward<TArgs>(args)...)
+        {
+        }
+
+        T m_value;
+        node* m_next = nullptr;
+    };
+
+    /**
+     * @internal
+     * @brief   The elimination slot, contains nullptr, the node offered by the push, or the
+     *          taken marker set by the pop which accepted the offer.
+     */
+    struct alignas(impl::config::s_cache_line_size) elimination_slot
+    {
+        std::atomic<node*> m_offer { nullptr };
+    };
+
+    /**
+     * The count of spins the push waits for the pop in the elimination slot.
+     */
+    static constexpr std::size_t s_elimination_spins = 64;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+public:
+    /**
+     * @brief   Constructs the empty stack, the elimination array size is based on the hardware
+     *          concurrency.
+     */
+    concurrent_stack()
+        : m_slot_count(std::max(1u, std::thread::hardware_concurrency() / 2))
+        , m_slots(std::make_unique<elimination_slot[]>(m_slot_count))
+    {
+    }
+
+    /**
+     * Prevent copying and moving of an object.
+     */
+    concurrent_stack(const concurrent_stack&) = delete;
+    concurrent_stack(concurrent_stack&&) = delete;
+    concurrent_stack& operator=(const concurrent_stack&) = delete;
+    concurrent_stack& operator=(concurrent_stack&&) = delete;
+
+    /**
+     * @brief   Destroys the remaining elements. The stack should not be used concurrently.
+     */
+    ~concurrent_stack()
+    {
+        delete_list(m_head.load(std::memory_order_relaxed));
+    }
+
+public:
+    /**
+     * @brief       Inserts the copy of the element at the top.
+     *
+     * @param value The value to insert.
+     */
+    void push(const value_type& value)
+    {
+        emplace(value);
+    }
+
+    /**
+     * @brief       Inserts the element at the top using move semantic.
+     *
+     * @param value The value to insert.
+     */
+    void push(value_type&& value)
+    {
+        emplace(std::move(value));
+    }
+
+    /**
+     * @brief           Inserts a new element at the top, constructed in-place.
+     *
+     * @tparam TArgs    The types of list of arguments with which an instance of T will be
+     *                  constructed.
+     * @param args      List of arguments with which an instance of T will be constructed.
+     */
+    template <typename... TArgs>
+    void emplace(TArgs&&... args)
+    {
+        node* p_node = new node { std::forward<TArgs>(args)... };
+        while (true)
+        {
+            node* p_head = m_head.load(std::memory_order_relaxed);
+            p_node->m_next = p_head;
+            if (m_head.compare_exchange_weak(p_head, p_node, std::memory_order_release
+                    , std::memory_order_relaxed))
+            {
+                return;
+            }
+            if (try_eliminate_push(p_node))
+            {
+                return;
+            }
+        }
+    }
+
+    /**
+     * @brief       Inserts the elements of the range with the single CAS on the head, the last
+     *              element of the range becomes the top.
+     *
+     * @tparam TIt  The input iterator type.
+     * @param first The beginning of the range.
+     * @param last  The end of the range.
+     */
+    template <std::input_iterator TIt>
+    void push_range(TIt first, TIt last)
+    {
+        if (first == last)
+        {
+            return;
+        }
+        // The batch is owned by the chain until it's published, so the already created nodes
+        // are destroyed if the construction of the next one throws.
+        std::unique_ptr<node, void (*)(node*)> p_top { new node { *first }, &delete_list };
+        node* p_bottom = p_top.get();
+        for (++first; first != last; ++first)
+        {
+            node* p_node = new node { *first };
+            p_node->m_next = p_top.release();
+            p_top.reset(p_node);
+        }
+        node* p_head = m_head.load(std::memory_order_relaxed);
+        do
+        {
+            p_bottom->m_next = p_head;
+        }
+        while (!m_head.compare_exchange_weak(p_head, p_top.get(), std::memory_order_release
+                , std::memory_order_relaxed));
+        (void) p_top.release();
+    }
+
+    /**
+     * @brief   Removes the top element.
+     *
+     * @return  The removed element or empty if the stack is empty.
+     */
+    std::optional<value_type> try_pop()
+    {
+        while (true)
+        {
+            impl::epoch_domain::guard guard;
+            node* p_head = m_head.load(std::memory_order_acquire);
+            if (nullptr == p_head)
+            {
+                return std::nullopt;
+            }
+            if (m_head.compare_exchange_weak(p_head, p_head->m_next, std::memory_order_acquire
+                    , std::memory_order_relaxed))
+            {
+                std::optional<value_type> result { std::move(p_head->m_value) };
+                impl::epoch_domain::instance().retire(p_head);
+                return result;
+            }
+            if (node* p_offer = try_eliminate_pop())
+            {
+                std::optional<value_type> result { std::move(p_offer->m_value) };
+                delete p_offer;
+                return result;
+            }
+        }
+    }
+
+    /**
+     * @brief   Removes all elements with the single exchange of the head.
+     *
+     * @return  The removed elements, from the top to the bottom.
+     */
+    std::vector<value_type> pop_all()
+    {
+        std::vector<value_type> result;
+        impl::epoch_domain::guard guard;
+        node* p_node = m_head.exchange(nullptr, std::memory_order_acquire);
+        while (nullptr != p_node)
+        {
+            node* p_next = p_node->m_next;
+            result.push_back(std::move(p_node->m_value));
+            impl::epoch_domain::instance().retire(p_node);
+            p_node = p_next;
+        }
+        return result;
+    }
+
+    /**
+     * @brief   Checks the stack has no elements, the result may be outdated under concurrent
+     *          modifications.
+     *
+     * @return  true if the stack is empty, otherwise false.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return nullptr == m_head.load(std::memory_order_relaxed);
+    }
+
+private:
+    /**
+     * @internal
+     * @brief   Offers the node in the random elimination slot and waits for the pop.
+     *
+     * @return  true if the node was taken by the pop, otherwise false.
+     */
+    bool try_eliminate_push(node* p_node)
+    {
+        std::atomic<node*>& offer = random_slot();
+        node* p_expected = nullptr;
+        if (!offer.compare_exchange_strong(p_expected, p_node, std::memory_order_release
+                , std::memory_order_relaxed))
+        {
+            return false;
+        }
+        for (std::size_t i = 0; i < s_elimination_spins; ++i)
+        {
+            if (offer.load(std::memory_order_acquire) != p_node)
+            {
+                break;
+            }
+        }
+        p_expected = p_node;
+        if (offer.compare_exchange_strong(p_expected, nullptr, std::memory_order_relaxed))
+        {
+            return false;
+        }
+        // The offer is taken, release the slot for the other threads.
+        offer.store(nullptr, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @internal
+     * @brief   Takes the node offered by the concurrent push.
+     *
+     * @return  The taken node or nullptr.
+     */
+    node* try_eliminate_pop()
+    {
+        std::atomic<node*>& offer = random_slot();
+        node* p_offer = offer.load(std::memory_order_acquire);
+        if (nullptr == p_offer || taken_marker() == p_offer)
+        {
+            return nullptr;
+        }
+        if (!offer.compare_exchange_strong(p_offer, taken_marker(), std::memory_order_acquire
+                , std::memory_order_relaxed))
+        {
+            return nullptr;
+        }
+        return p_offer;
+    }
+
+    std::atomic<node*>& random_slot() noexcept
+    {
+        return m_slots[impl::thread_local_random(m_slot_count)].m_offer;
+    }
+
+    /**
+     * @internal
+     * @brief   The address of the marker is never used by the real node.
+     */
+    static node* taken_marker() noexcept
+    {
+        alignas(node) static char s_marker;
+        return reinterpret_cast<node*>(&s_marker);
+    }
+
+    static void delete_list(node* p_node)
+    {
+        while (nullptr != p_node)
+        {
+            delete std::exchange(p_node, p_node->m_next);
+        }
+    }
+
+private:
+    alignas(impl::config::s_cache_line_size) std::atomic<node*> m_head { nullptr };
+
+    /**
+     * The elimination array.
+     */
+    alignas(impl::config::s_cache_line_size) const size_type m_slot_count;
+    std::unique_ptr<elimination_slot[]> m_slots;
+}; // class concurrent_stack
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace ts
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#endif // THREADSAFESMARTPOINTERS_TS_CONCURRENT_STACK_H
@@ -0,0 +1,441 @@
+#ifndef THREADSAFESMARTPOINTERS_TS_CONCURRENT_VECTOR_H
+#define THREADSAFESMARTPOINTERS_TS_CONCURRENT_VECTOR_H
+
+/**
+ * @file        ts_concurrent_vector.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of concurrent vector with lock-free push_back.
+ * @date        10/18/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "impl/ts_config.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace ts {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief           ts::concurrent_vector is an append-only sequence container which allows
+ *                  many threads to grow it and read published elements concurrently.
+ *
+ * @details         The storage is split into segments of geometrically growing sizes, the
+ *                  segment N holds (s_first_segment_size << N) elements. The segments are never
+ *                  reallocated, so the elements are never relocated and the references to them
+ *                  stay valid until the vector destruction.
+ *                  Appending reserves the slot index with a single atomic increment, allocates
+ *                  the segment on first touch and constructs the element in place. An element
+ *                  is published (visible for readers) after its construction is finished.
+ * @example         ts::concurrent_vector<int> vec;
+ *                  // many threads
+ *                  vec.push_back(13);
+ *                  // reader thread
+ *                  vec.for_each([](const int& val) { std::cout << val; });
+ * @warning         The container protects only its own structure, the published elements
+ *                  itself are not guarded. Modifying the element concurrently with readers is
+ *                  a data race.
+ * @warning         size() counts the reserved slots, that elements may be still under
+ *                  construction. Use is_published() or at() to check the slot state.
+ * @tparam T        The type of the elements.
+ */
+template <typename T>
+class concurrent_vector
+{
+public:
+    /**
+     * T, the type of the elements.
+     */
+    using value_type = T;
+
+    /**
+     * The unsigned integer type for the sizes and the indexes.
+     */
+    using size_type = std::size_t;
+
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+private:
+    /**
+     * The size of first segment, should be power of two.
+     */
+    static constexpr size_type s_first_segment_size = 8;
+    static constexpr size_type s_first_segment_log = std::countr_zero(s_first_segment_size);
+
+    /**
+     * The maximal count of the segments, enough to cover all addressable indexes.
+     */
+    static constexpr size_type s_segment_count
+            = std::numeric_limits<size_type>::digits - s_first_segment_log;
+
+    static_assert(std::has_single_bit(s_first_segment_size));
+
+    /**
+     * @internal
+     * @brief   The storage for the single element and the publication flag.
+     */
+    struct slot
+    {
+        std::atomic_bool m_published { false };
+        alignas(T) std::byte m_storage[sizeof(T)];
+
+        T* data() noexcept
+        {
+            return std::launder(reinterpret_cast<T*>(m_storage));
+        }
+
+        const T* data() const noexcept
+        {
+            return std::launder(reinterpret_cast<const T*>(m_storage));
+        }
+    };
+
+public:
+    concurrent_vector() = default;
+
+    /**
+     * @brief       Constructs the vector with count default-inserted elements.
+     *
+     * @param count The count of elements.
+     */
+    explicit concurrent_vector(size_type count)
+    {
+        (void) grow_by(count);
+    }
+
+    /**
+     * @brief       Destroys all published elements and frees the segments.
+     *
+     * @warning     The destructor is not thread-safe, no other thread should access the vector.
+     */
+    ~concurrent_vector()
+    {
+        clear();
+    }
+
+    /**
+     * Prevent copying and moving of an object.
+     */
+    concurrent_vector(const concurrent_vector&) = delete;
+    concurrent_vector(concurrent_vector&&) = delete;
+    concurrent_vector& operator=(const concurrent_vector&) = delete;
+    concurrent_vector& operator=(concurrent_vector&&) = delete;
+
+public:
+    /**
+     * @brief       Appends the copy of the given element to the end of the vector.
+     *
+     * @param value The value to append.
+     * @return      The index of the appended element.
+     */
+    size_type push_back(const value_type& value)
+    {
+        return emplace_back(value);
+    }
+
+    /**
+     * @brief       Appends the given element to the end of the vector using move semantic.
+     *
+     * @param value The value to append.
+     * @return      The index of the appended element.
+     */
+    size_type push_back(value_type&& value)
+    {
+        return emplace_back(std::move(value));
+    }
+
+    /**
+     * @brief           Appends a new element to the end of the vector. The element is
+     *                  constructed in-place.
+     *
+     * @tparam TArgs    The types of list of arguments with which an instance of T will be
+     *                  constructed.
+     * @param args      List of arguments with which an instance of T will be constructed.
+     * @return          The index of the appended element.
+     */
+    template <typename... TArgs>
+    size_type emplace_back(TArgs&&... args)
+    {
+        const size_type index = m_size.fetch_add(1, std::memory_order_relaxed);
+        construct_at(index, std::forward<TArgs>(args)...);
+        return index;
+    }
+
+    /**
+     * @brief       Reserves count consecutive slots with single atomic operation and
+     *              default-constructs elements in them.
+     *
+     * @param count The count of elements to append.
+     * @return      The index of the first appended element.
+     */
+    size_type grow_by(size_type count)
+    {
+        const size_type first = m_size.fetch_add(count, std::memory_order_relaxed);
+        for (size_type index = first; index < first + count; ++index)
+        {
+            construct_at(index);
+        }
+        return first;
+    }
+
+    /**
+     * @brief       Reserves count consecutive slots with single atomic operation and
+     *              copy-constructs elements from the given value in them.
+     *
+     * @param count The count of elements to append.
+     * @param value The value to copy.
+     * @return      The index of the first appended element.
+     */
+    size_type grow_by(size_type count, const value_type& value)
+    {
+        const size_type first = m_size.fetch_add(count, std::memory_order_relaxed);
+        for (size_type index = first; index < first + count; ++index)
+        {
+            construct_at(index, value);
+        }
+        return first;
+    }
+
+public:
+    /**
+     * @brief       Gets the element by the index without any check.
+     *
+     * @warning     The behaviour is undefined if the element is not published.
+     * @param index The element index.
+     * @return      The reference to the element.
+     */
+    reference operator[](size_type index) noexcept
+    {
+        return *(slot_at(index).data());
+    }
+
+    /**
+     * @brief       Gets the element by the index without any check.
+     *
+     * @warning     The behaviour is undefined if the element is not published.
+     * @param index The element index.
+     * @return      The const reference to the element.
+     */
+    const_reference operator[](size_type index) const noexcept
+    {
+        return *(slot_at(index).data());
+    }
+
+    /**
+     * @brief       Gets the element by the index with bounds checking.
+     *
+     * @throws      std::out_of_range if the element with given index is not published.
+     * @param index The element index.
+     * @return      The reference to the element.
+     */
+    reference at(size_type index)
+    {
+        return const_cast<reference>(std::as_const(*this).at(index));
+    }
+
+    /**
+     * @brief       Gets the element by the index with bounds checking.
+     *
+     * @throws      std::out_of_range if the element with given index is not published.
+     * @param index The element index.
+     * @return      The const reference to the element.
+     */
+    const_reference at(size_type index) const
+    {
+        if (!is_published(index))
+        {
+            if constexpr (impl::config::s_enable_exceptions)
+            {
+                throw std::out_of_range { "ts::concurrent_vector element is not published." };
+            }
+            else
+            {
+                std::terminate();
+            }
+        }
+        return *(slot_at(index).data());
+    }
+
+    /**
+     * @brief       Checks the element with given index is constructed and visible for readers.
+     *
+     * @param index The element index.
+     * @return      true if the element is published, otherwise false.
+     */
+    [[nodiscard]] bool is_published(size_type index) const noexcept
+    {
+        if (index >= size())
+        {
+            return false;
+        }
+        const auto [segment, offset] = locate(index);
+        const slot* p_segment = m_segments[segment].load(std::memory_order_acquire);
+        return nullptr != p_segment
+                && p_segment[offset].m_published.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief       Calls the given function for all published elements in the index order.
+     *
+     * @tparam TFunc The function type, should be invocable with const T&.
+     * @param func  The function object.
+     */
+    template <typename TFunc>
+    void for_each(TFunc&& func) const
+    {
+        const size_type count = size();
+        for (size_type index = 0; index < count; ++index)
+        {
+            if (is_published(index))
+            {
+                func(*(slot_at(index).data()));
+            }
+        }
+    }
+
+    /**
+     * @brief   Gets the count of the reserved slots.
+     *
+     * @return  The vector size.
+     */
+    [[nodiscard]] size_type size() const noexcept
+    {
+        return m_size.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief   Checks the vector has no reserved slots.
+     *
+     * @return  true if the vector is empty, otherwise false.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return 0 == size();
+    }
+
+    /**
+     * @brief   Destroys all elements and frees the segments.
+     *
+     * @warning This API is not thread-safe, no other thread should access the vector.
+     */
+    void clear() noexcept
+    {
+        const size_type count = m_size.exchange(0, std::memory_order_acq_rel);
+        for (size_type segment = 0; segment < s_segment_count; ++segment)
+        {
+            slot* p_segment = m_segments[segment].exchange(nullptr, std::memory_order_acq_rel);
+            if (nullptr == p_segment)
+            {
+                continue;
+            }
+            const size_type first = segment_first_index(segment);
+            const size_type length = segment_size(segment);
+            for (size_type offset = 0; offset < length && first + offset < count; ++offset)
+            {
+                if (p_segment[offset].m_published.load(std::memory_order_relaxed))
+                {
+                    std::destroy_at(p_segment[offset].data());
+                }
+            }
+            delete[] p_segment;
+        }
+    }
+
+private:
+    /**
+     * @internal
+     * @brief       Constructs the element in the reserved slot and publishes it.
+     */
+    template <typename... TArgs>
+    void construct_at(size_type index, TArgs&&... args)
+    {
+        const auto [segment, offset] = locate(index);
+        slot& target = acquire_segment(segment)[offset];
+        ::new (static_cast<void*>(target.m_storage)) T(std::forward<TArgs>(args)...);
+        target.m_published.store(true, std::memory_order_release);
+    }
+
+    /**
+     * @internal
+     * @brief       Gets the segment, allocates it if it is not allocated yet.
+     *              If several threads allocate the same segment, only one wins the race.
+     */
+    slot* acquire_segment(size_type segment)
+    {
+        slot* p_segment = m_segments[segment].load(std::memory_order_acquire);
+        if (nullptr != p_segment)
+        {
+            return p_segment;
+        }
+        auto p_new_segment = std::make_unique<slot[]>(segment_size(segment));
+        if (m_segments[segment].compare_exchange_strong(p_segment, p_new_segment.get()
+                , std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            return p_new_segment.release();
+        }
+        return p_segment;
+    }
+
+    /**
+     * @internal
+     * @brief       Gets the slot of the already allocated segment.
+     */
+    slot& slot_at(size_type index) const noexcept
+    {
+        const auto [segment, offset] = locate(index);
+        return m_segments[segment].load(std::memory_order_acquire)[offset];
+    }
+
+    /**
+     * @internal
+     * @brief       Calculates the segment number and the offset inside the segment.
+     */
+    static constexpr std::pair<size_type, size_type> locate(size_type index) noexcept
+    {
+        const size_type biased = index + s_first_segment_size;
+        const size_type segment
+                = static_cast<size_type>(std::bit_width(biased | s_first_segment_size))
+                    - 1 - s_first_segment_log;
+        return { segment, biased - (s_first_segment_size << segment) };
+    }
+
+    static constexpr size_type segment_size(size_type segment) noexcept
+    {
+        return s_first_segment_size << segment;
+    }
+
+    static constexpr size_type segment_first_index(size_type segment) noexcept
+    {
+        return (s_first_segment_size << segment) - s_first_segment_size;
+    }
+
+private:
+    /**
+     * The count of the reserved slots.
+     */
+    std::atomic<size_type> m_size { 0 };
+
+    /**
+     * The table of the lazily allocated segments.
+     */
+    std::atomic<slot*> m_segments[s_segment_count] {};
+}; // class concurrent_vector
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace ts
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#endif // THREADSAFESMARTPOINTERS_TS_CONCURRENT_VECTOR_H
@@ -9,6 +9,8 @@
  * @copyright   Copyright (c) 2021
  */
 
+#include <cstddef>
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 namespace ts::impl::config {
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -18,6 +20,51 @@ namespace ts::impl::config {
  */
 constexpr bool s_enable_exceptions = true;
 
+/**
+ *  The assumed cache line size, used for padding the data shared between threads.
+ */
+constexpr std::size_t s_cache_line_size = 64;
+
+/**
+ *  API for checking the lock hierarchy of ts::ranked_mutex, enabled in the debug builds.
+ */
+#ifdef NDEBUG
+constexpr bool s_check_lock_order = false;
+#else
+constexpr bool s_check_lock_order = true;
+#endif
+
+/**
+ *  API for instrumenting the mutexes of all ts::shared_ptr and ts::unique_ptr with
+ *  ts::instrumented_mutex, enabled by defining THREADSAFESMARTPOINTERS_INSTRUMENT_LOCKS.
+ */
+#ifdef THREADSAFESMARTPOINTERS_INSTRUMENT_LOCKS
+constexpr bool s_instrument_locks = true;
+#else
+constexpr bool s_instrument_locks = false;
+#endif
+
+/**
+ *  API for accounting the memory footprint of the objects, mutexes and control blocks of
+ *  ts::shared_ptr and ts::unique_ptr per managed type, enabled by defining
+ *  THREADSAFESMARTPOINTERS_TRACK_FOOTPRINT.
+ */
+#ifdef THREADSAFESMARTPOINTERS_TRACK_FOOTPRINT
+constexpr bool s_track_footprint = true;
+#else
+constexpr bool s_track_footprint = false;
+#endif
+
+/**
+ *  API for capturing the stacks of the contended acquisitions of ts::instrumented_mutex for the
+ *  contention flame graphs, enabled by defining THREADSAFESMARTPOINTERS_PROFILE_CONTENTION.
+ */
+#ifdef THREADSAFESMARTPOINTERS_PROFILE_CONTENTION
+constexpr bool s_profile_contention = true;
+#else
+constexpr bool s_profile_contention = false;
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 } // namespace ts::impl::config
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,285 @@
+#ifndef THREADSAFESMARTPOINTERS_TS_CONTENTION_PROFILER_H
+#define THREADSAFESMARTPOINTERS_TS_CONTENTION_PROFILER_H
+
+/**
+ * @file        ts_contention_profiler.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the contention profiler for flame graphs.
+ * @date        10/18/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
+#include "impl/ts_config.h"
+#include "impl/ts_instrumentation.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace ts {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @internal
+ * @brief   Gets the demangled function name of the return address without the offset, e.g.
+ *          "app::handle(request const&)", or the module and the offset if the symbol is
+ *          unknown, e.g. "app+0x1a2b".
+ */
+inline std::string symbol_name_of(void* p_frame)
+{
+#if defined(__GLIBC__) || defined(__APPLE__)
+    std::unique_ptr<char*, decltype(&std::free)> p_symbols {
+        ::backtrace_symbols(&p_frame, 1), &std::free };
+    if (nullptr != p_symbols)
+    {
+        // The glibc format is "module(function+offset) [address]".
+        const std::string symbol = p_symbols.get()[0];
+        const auto open = symbol.find('(');
+        const auto plus = symbol.find('+', open);
+        const auto close = symbol.find(')', open);
+        if (std::string::npos == open || std::string::npos == plus
+                || std::string::npos == close || plus > close)
+        {
+            return symbol;
+        }
+        std::string function = symbol.substr(open + 1, plus - open - 1);
+        if (function.empty())
+        {
+            const std::string module = symbol.substr(0, open);
+            return module.substr(module.find_last_of('/') + 1)
+                    + symbol.substr(plus, close - plus);
+        }
+#if defined(__GNUG__)
+        int status = 0;
+        std::unique_ptr<char, decltype(&std::free)> p_demangled {
+            abi::__cxa_demangle(function.c_str(), nullptr, nullptr, &status), &std::free };
+        if (0 == status && nullptr != p_demangled)
+        {
+            function = p_demangled.get();
+        }
+#endif
+        return function;
+    }
+#endif
+    std::ostringstream stream;
+    stream << p_frame;
+    return stream.str();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   The aggregated call stack of the contention profile, the outermost frame first.
+ */
+struct contention_stack
+{
+    std::vector<std::string> m_frames {};
+    std::uint64_t m_count = 0;
+    std::chrono::nanoseconds m_wait { 0 };
+};
+
+/**
+ * @brief   ts::contention_profile is the set of the stacks of the contended acquisitions: the
+ *          stacks of the waiters, and the stacks of the holders which made them wait, weighted
+ *          by the wait duration. The stacks are written in the collapsed stack format consumed
+ *          by the flame graph tools (flamegraph.pl, speedscope, inferno), one stack per line:
+ *          "outer;inner;innermost <wait in nanoseconds>".
+ */
+class contention_profile
+{
+public:
+    contention_profile() = default;
+
+    contention_profile(std::vector<contention_stack> waiters, std::vector<contention_stack> holders)
+        : m_waiters(std::move(waiters))
+        , m_holders(std::move(holders))
+    {
+    }
+
+    [[nodiscard]] const std::vector<contention_stack>& waiters() const noexcept
+    {
+        return m_waiters;
+    }
+
+    /**
+     * @brief   Gets the stacks of the exclusive holders at the acquisition, captured only if the
+     *          profiler was asked to. The unknown holder is reported as "[unknown holder]".
+     */
+    [[nodiscard]] const std::vector<contention_stack>& holders() const noexcept
+    {
+        return m_holders;
+    }
+
+    /**
+     * @brief   Writes the waiter stacks in the collapsed stack format.
+     */
+    void write_collapsed(std::ostream& out) const
+    {
+        write_stacks(out, m_waiters);
+    }
+
+    /**
+     * @brief   Writes the holder stacks in the collapsed stack format.
+     */
+    void write_holders_collapsed(std::ostream& out) const
+    {
+        write_stacks(out, m_holders);
+    }
+
+private:
+    static void write_stacks(std::ostream& out, const std::vector<contention_stack>& stacks)
+    {
+        for (const auto& stack : stacks)
+        {
+            for (std::size_t i = 0; i < stack.m_frames.size(); ++i)
+            {
+                out << (0 == i ? "" : ";") << stack.m_frames[i];
+            }
+            out << " " << stack.m_wait.count() << "\n";
+        }
+    }
+
+private:
+    std::vector<contention_stack> m_waiters {};
+    std::vector<contention_stack> m_holders {};
+}; // class contention_profile
+
+/**
+ * @brief   ts::contention_profiler captures the call stack of the waiter on every contended
+ *          acquisition of the instrumented mutexes from the construction until the destruction,
+ *          and optionally the stack of the last exclusive holder recorded at its acquisition.
+ *          The capturing is compiled only if THREADSAFESMARTPOINTERS_PROFILE_CONTENTION is
+ *          defined, otherwise the profile is empty. Only one profiler should be alive at a time.
+ *
+ * @details The stacks are captured by backtrace(), the function names are resolved when the
+ *          profile is collected, link with -rdynamic to see the names of the executable
+ *          functions. Capturing the holder stacks costs the backtrace on every exclusive
+ *          acquisition while the profiler is alive.
+ * @example ts::contention_profiler profiler { true };
+ *          run_workload();
+ *          const auto profile = profiler.collect();
+ *          std::ofstream waiters { "waiters.folded" };
+ *          profile.write_collapsed(waiters);
+ *          std::ofstream holders { "holders.folded" };
+ *          profile.write_holders_collapsed(holders);
+ *          // flamegraph.pl waiters.folded > waiters.svg
+ */
+class contention_profiler
+{
+public:
+    /**
+     * @brief                   Starts the capturing, the previous stacks are dropped.
+     *
+     * @param capture_holders   Captures the stacks of the exclusive holders.
+     */
+    explicit contention_profiler(bool capture_holders = false)
+    {
+        impl::contention_stack_sink::instance().start(capture_holders);
+    }
+
+    ~contention_profiler()
+    {
+        impl::contention_stack_sink::instance().stop();
+    }
+
+    /**
+     * Prevent copying and moving of an object.
+     */
+    contention_profiler(const contention_profiler&) = delete;
+    contention_profiler(contention_profiler&&) = delete;
+    contention_profiler& operator=(const contention_profiler&) = delete;
+    contention_profiler& operator=(contention_profiler&&) = delete;
+
+    /**
+     * @brief   Collects the stacks captured so far, ordered by the wait from the most waited.
+     *          The capturing continues.
+     */
+    [[nodiscard]] contention_profile collect() const
+    {
+        const bool has_holders = impl::contention_stack_sink::instance().captures_holders();
+        std::unordered_map<void*, std::string> names;
+        auto symbolize = [&names](const std::vector<void*>& frames)
+        {
+            std::vector<std::string> result;
+            result.reserve(frames.size());
+            std::for_each(frames.rbegin(), frames.rend(), [&names, &result](void* p_frame)
+            {
+                auto it = names.find(p_frame);
+                if (it == names.end())
+                {
+                    it = names.emplace(p_frame, impl::symbol_name_of(p_frame)).first;
+                }
+                result.push_back(it->second);
+            });
+            return result;
+        };
+
+        std::map<std::vector<std::string>, contention_stack> waiters;
+        std::map<std::vector<std::string>, contention_stack> holders;
+        auto add = [](std::map<std::vector<std::string>, contention_stack>& stacks
+                , std::vector<std::string> frames, const auto& weight)
+        {
+            contention_stack& stack = stacks[frames];
+            stack.m_frames = std::move(frames);
+            stack.m_count += weight.m_count;
+            stack.m_wait += std::chrono::nanoseconds {
+                    static_cast<std::chrono::nanoseconds::rep>(weight.m_wait_ns) };
+        };
+        for (const auto& [key, weight] : impl::contention_stack_sink::instance().collect())
+        {
+            add(waiters, symbolize(key.first), weight);
+            if (has_holders)
+            {
+                add(holders, key.second.empty()
+                        ? std::vector<std::string> { "[unknown holder]" }
+                        : symbolize(key.second), weight);
+            }
+        }
+        return contention_profile { sorted(waiters), sorted(holders) };
+    }
+
+private:
+    static std::vector<contention_stack> sorted(
+            std::map<std::vector<std::string>, contention_stack>& stacks)
+    {
+        std::vector<contention_stack> result;
+        result.reserve(stacks.size());
+        for (auto& [frames, stack] : stacks)
+        {
+            result.push_back(std::move(stack));
+        }
+        std::ranges::sort(result, [](const contention_stack& lhs, const contention_stack& rhs)
+        {
+            return lhs.m_wait > rhs.m_wait;
+        });
+        return result;
+    }
+}; // class contention_profiler
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace ts
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#endif // THREADSAFESMARTPOINTERS_TS_CONTENTION_PROFILER_H
@@ -0,0 +1,374 @@
+#ifndef THREADSAFESMARTPOINTERS_TS_EPOCH_H
+#define THREADSAFESMARTPOINTERS_TS_EPOCH_H
+
+/**
+ * @file        ts_epoch.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of epoch-based memory reclamation.
+ * @date        10/18/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "impl/ts_config.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace ts::impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @internal
+ *
+ * @class           epoch_domain
+ * @brief           The epoch-based reclamation domain for lock-free data structures.
+ *
+ * @details         Threads which access shared nodes pin the current global epoch for the
+ *                  duration of access using epoch_domain::guard. Unlinked nodes are retired
+ *                  with the epoch of retirement and are deleted only when the global epoch
+ *                  went two steps further, that time no thread can hold a reference to them.
+ *                  The global epoch advances only when all pinned threads observed it.
+ * @example         {
+ *                      ts::impl::epoch_domain::guard guard;
+ *                      // read shared nodes
+ *                      ts::impl::epoch_domain::instance().retire(p_unlinked);
+ *                  }
+ */
+class epoch_domain
+{
+    /**
+     * The count of retirements after that the thread tries to advance the epoch and collect.
+     */
+    static constexpr std::uint32_t s_collect_period = 64;
+
+    /**
+     * The bit shows the participant is inside the critical section.
+     */
+    static constexpr std::uint64_t s_pinned_bit = 1;
+
+    using t_deleter = void (*)(void*);
+
+    /**
+     * @internal
+     * @brief   The retired object waiting for the safe moment to be deleted.
+     */
+    struct retired
+    {
+        void* m_ptr;
+        t_deleter m_deleter;
+        std::uint64_t m_epoch;
+    };
+
+    /**
+     * @internal
+     * @brief   The per-thread record of the domain.
+     */
+    struct alignas(config::s_cache_line_size) participant
+    {
+        std::atomic<std::uint64_t> m_state { 0 };
+        std::atomic_bool m_in_use { true };
+        participant* m_next = nullptr;
+        std::uint32_t m_nesting = 0;
+        std::uint32_t m_retire_count = 0;
+        std::vector<retired> m_retired {};
+    };
+
+    /**
+     * @internal
+     * @brief   The owner of the thread participant, releases it on thread exit.
+     */
+    class participant_handle
+    {
+    public:
+        explicit participant_handle(epoch_domain& domain)
+            : m_domain(domain)
+            , m_participant(domain.acquire_participant())
+        {
+        }
+
+        ~participant_handle()
+        {
+            m_domain.release_participant(*m_participant);
+        }
+
+        participant_handle(const participant_handle&) = delete;
+        participant_handle(participant_handle&&) = delete;
+        participant_handle& operator=(const participant_handle&) = delete;
+        participant_handle& operator=(participant_handle&&) = delete;
+
+        participant& get() noexcept
+        {
+            return *m_participant;
+        }
+
+    private:
+        epoch_domain& m_domain;
+        participant* m_participant;
+    };
+
+public:
+    /**
+     * @brief   The RAII-style critical section, pins the epoch for the guard lifetime.
+     *          The guards could be nested.
+     */
+    class guard
+    {
+    public:
+        guard()
+            : m_participant(epoch_domain::instance().local())
+        {
+            epoch_domain::instance().pin(m_participant);
+        }
+
+        ~guard()
+        {
+            epoch_domain::unpin(m_participant);
+        }
+
+        guard(const guard&) = delete;
+        guard(guard&&) = delete;
+        guard& operator=(const guard&) = delete;
+        guard& operator=(guard&&) = delete;
+
+    private:
+        participant& m_participant;
+    };
+
+public:
+    /**
+     * @brief   Gets the process-wide domain.
+     *
+     * @return  The reference to the domain.
+     */
+    static epoch_domain& instance()
+    {
+        static epoch_domain s_domain;
+        return s_domain;
+    }
+
+    epoch_domain() = default;
+
+    epoch_domain(const epoch_domain&) = delete;
+    epoch_domain(epoch_domain&&) = delete;
+    epoch_domain& operator=(const epoch_domain&) = delete;
+    epoch_domain& operator=(epoch_domain&&) = delete;
+
+    /**
+     * @brief   Deletes all retired objects and participants.
+     *
+     * @warning The domain should be destroyed after all threads finished.
+     */
+    ~epoch_domain()
+    {
+        participant* p_participant = m_participants.exchange(nullptr);
+        while (nullptr != p_participant)
+        {
+            for (auto& item : p_participant->m_retired)
+            {
+                item.m_deleter(item.m_ptr);
+            }
+            delete std::exchange(p_participant, p_participant->m_next);
+        }
+        for (auto& item : m_orphans)
+        {
+            item.m_deleter(item.m_ptr);
+        }
+    }
+
+    /**
+     * @brief           Retires the unlinked object, it will be deleted using the given deleter
+     *                  when no thread can hold a reference to it.
+     *
+     * @param ptr       The unlinked object pointer.
+     * @param deleter   The function for object deletion.
+     */
+    void retire(void* ptr, t_deleter deleter)
+    {
+        participant& self = local();
+        self.m_retired.push_back({ ptr, deleter, m_global_epoch.load(std::memory_order_seq_cst) });
+        if (++self.m_retire_count >= s_collect_period)
+        {
+            self.m_retire_count = 0;
+            (void) try_advance();
+            collect(self);
+        }
+    }
+
+    /**
+     * @brief           Retires the unlinked object, it will be deleted using operator delete
+     *                  when no thread can hold a reference to it.
+     *
+     * @tparam T        The object type.
+     * @param ptr       The unlinked object pointer.
+     */
+    template <typename T>
+    void retire(T* ptr)
+    {
+        retire(ptr, [](void* p) { delete static_cast<T*>(p); });
+    }
+
+    /**
+     * @brief   Tries to advance the epoch and deletes the retired objects of the current
+     *          thread which are safe to delete.
+     */
+    void collect()
+    {
+        (void) try_advance();
+        collect(local());
+    }
+
+private:
+    participant& local()
+    {
+        static thread_local participant_handle s_handle { *this };
+        return s_handle.get();
+    }
+
+    void pin(participant& self) noexcept
+    {
+        if (0 != self.m_nesting++)
+        {
+            return;
+        }
+        const std::uint64_t epoch = m_global_epoch.load(std::memory_order_relaxed);
+        self.m_state.store((epoch << 1) | s_pinned_bit, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+
+    static void unpin(participant& self) noexcept
+    {
+        if (0 != --self.m_nesting)
+        {
+            return;
+        }
+        self.m_state.store(0, std::memory_order_release);
+    }
+
+    /**
+     * @internal
+     * @brief   Advances the global epoch if all pinned participants observed the current one.
+     */
+    bool try_advance() noexcept
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::uint64_t epoch = m_global_epoch.load(std::memory_order_seq_cst);
+        for (participant* p = m_participants.load(std::memory_order_acquire); nullptr != p
+                ; p = p->m_next)
+        {
+            const std::uint64_t state = p->m_state.load(std::memory_order_acquire);
+            if (0 != (state & s_pinned_bit) && (state >> 1) != epoch)
+            {
+                return false;
+            }
+        }
+        return m_global_epoch.compare_exchange_strong(epoch, epoch + 1
+                , std::memory_order_seq_cst);
+    }
+
+    /**
+     * @internal
+     * @brief   Deletes the objects retired two epochs ago, including the orphaned ones.
+     */
+    void collect(participant& self)
+    {
+        const std::uint64_t epoch = m_global_epoch.load(std::memory_order_seq_cst);
+        auto is_safe = [epoch](const retired& item) { return item.m_epoch + 2 <= epoch; };
+
+        std::erase_if(self.m_retired, [&is_safe](const retired& item)
+        {
+            if (is_safe(item))
+            {
+                item.m_deleter(item.m_ptr);
+                return true;
+            }
+            return false;
+        });
+
+        std::unique_lock lock { m_orphans_mtx, std::try_to_lock };
+        if (lock.owns_lock())
+        {
+            std::erase_if(m_orphans, [&is_safe](const retired& item)
+            {
+                if (is_safe(item))
+                {
+                    item.m_deleter(item.m_ptr);
+                    return true;
+                }
+                return false;
+            });
+        }
+    }
+
+    /**
+     * @internal
+     * @brief   Reuses the released participant or registers the new one.
+     */
+    participant* acquire_participant()
+    {
+        for (participant* p = m_participants.load(std::memory_order_acquire); nullptr != p
+                ; p = p->m_next)
+        {
+            bool in_use = false;
+            if (!p->m_in_use.load(std::memory_order_relaxed)
+                    && p->m_in_use.compare_exchange_strong(in_use, true
+                            , std::memory_order_acquire))
+            {
+                return p;
+            }
+        }
+        auto* p_new = new participant {};
+        p_new->m_next = m_participants.load(std::memory_order_relaxed);
+        while (!m_participants.compare_exchange_weak(p_new->m_next, p_new
+                , std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
+        return p_new;
+    }
+
+    /**
+     * @internal
+     * @brief   Hands the not yet deleted objects to the domain and releases the participant.
+     */
+    void release_participant(participant& self)
+    {
+        {
+            std::lock_guard lock { m_orphans_mtx };
+            m_orphans.insert(m_orphans.end(), self.m_retired.begin(), self.m_retired.end());
+        }
+        self.m_retired.clear();
+        self.m_retire_count = 0;
+        self.m_state.store(0, std::memory_order_release);
+        self.m_in_use.store(false, std::memory_order_release);
+    }
+
+private:
+    /**
+     * The global epoch.
+     */
+    alignas(config::s_cache_line_size)
+    std::atomic<std::uint64_t> m_global_epoch { 1 };
+
+    /**
+     * The list of registered participants, the participants are never removed.
+     */
+    std::atomic<participant*> m_participants { nullptr };
+
+    /**
+     * The objects retired by already finished threads.
+     */
+    std::mutex m_orphans_mtx {};
+    std::vector<retired> m_orphans {};
+}; // class epoch_domain
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace ts::impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#endif // THREADSAFESMARTPOINTERS_TS_EPOCH_H
@@ -0,0 +1,214 @@
+#ifndef THREADSAFESMARTPOINTERS_TS_FILE_IO_H
+#define THREADSAFESMARTPOINTERS_TS_FILE_IO_H
+
+/**
+ * @file        ts_file_io.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the file I/O directly from the guarded arrays.
+ * @date        10/18/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/types.h>
+#include <sys/uio.h>
+#endif
+
+#include "impl/ts_config.h"
+#include "ts_null_ptr_exception.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace ts::impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @internal
+ * @brief   Checks the elements of the array could be written to the file and read back as bytes.
+ */
+template <typename T>
+concept is_file_io_element = std::is_array_v<T>
+        && std::is_trivially_copyable_v<std::remove_extent_t<T>>;
+
+/**
+ * @internal
+ * @brief   The extent of the single object owned by ts::unique_ptr, it's always unknown.
+ */
+template <typename T>
+struct array_extent
+{
+    [[nodiscard]] static constexpr std::optional<std::size_t> get() noexcept
+    {
+        return std::nullopt;
+    }
+
+    constexpr void set(std::optional<std::size_t>) noexcept
+    { }
+};
+
+/**
+ * @internal
+ * @brief   The count of the elements of the array owned by ts::unique_ptr, it's known only if
+ *          the array was created by ts::make_unique.
+ */
+template <typename T>
+struct array_extent<T[]>
+{
+    [[nodiscard]] constexpr std::optional<std::size_t> get() const noexcept
+    {
+        return m_count;
+    }
+
+    constexpr void set(std::optional<std::size_t> count) noexcept
+    {
+        m_count = count;
+    }
+
+    std::optional<std::size_t> m_count {};
+};
+
+/**
+ * @internal
+ * @brief   Throws std::system_error with the given errno, or terminates if the exceptions are
+ *          disabled.
+ */
+[[noreturn]] inline void raise_io_error(int error, const char* message)
+{
+    if constexpr (config::s_enable_exceptions)
+    {
+        throw std::system_error { error, std::generic_category(), message };
+    }
+    else
+    {
+        std::terminate();
+    }
+}
+
+/**
+ * @internal
+ * @brief   Gets the span of the [begin, end) range of the array for the file I/O.
+ *
+ * @param   count The count of the elements of the array, std::nullopt if it's unknown.
+ * @throws  ts::null_ptr_exception if the array is null.
+ * @throws  std::out_of_range if begin is greater than end, or end is greater than the count.
+ */
+template <typename TValue>
+std::span<TValue> file_io_range(TValue* p_data, std::size_t begin, std::size_t end
+        , std::optional<std::size_t> count)
+{
+    if (nullptr == p_data)
+    {
+        if constexpr (config::s_enable_exceptions)
+        {
+            throw null_ptr_exception { "Trying to transfer the range of null pointer." };
+        }
+        else
+        {
+            std::terminate();
+        }
+    }
+    if (begin > end || (count.has_value() && end > *count))
+    {
+        if constexpr (config::s_enable_exceptions)
+        {
+            throw std::out_of_range { "ts file I/O range is outside the array." };
+        }
+        else
+        {
+            std::terminate();
+        }
+    }
+    return std::span<TValue> { p_data + begin, end - begin };
+}
+
+/**
+ * @internal
+ * @brief           Writes all bytes to the file at the offset by pwritev, continues after the
+ *                  partial writes and the interrupts.
+ *
+ * @throws          std::system_error if the write fails.
+ * @return          The count of written bytes.
+ */
+inline std::size_t write_file(int fd, std::uint64_t offset, std::span<const std::byte> bytes)
+{
+#if defined(__unix__) || defined(__APPLE__)
+    std::size_t done = 0;
+    while (done < bytes.size())
+    {
+        ::iovec buffer { const_cast<std::byte*>(bytes.data() + done), bytes.size() - done };
+        const ::ssize_t count = ::pwritev(fd, &buffer, 1, static_cast<::off_t>(offset + done));
+        if (count < 0)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+            raise_io_error(errno, "Failed to write the array to the file.");
+        }
+        done += static_cast<std::size_t>(count);
+    }
+    return done;
+#else
+    (void) fd;
+    (void) offset;
+    (void) bytes;
+    raise_io_error(ENOSYS, "The file I/O of the arrays is not supported on this platform.");
+#endif
+}
+
+/**
+ * @internal
+ * @brief           Reads the bytes from the file at the offset by preadv, continues after the
+ *                  partial reads and the interrupts until the buffer is filled or the end of the
+ *                  file is reached.
+ *
+ * @throws          std::system_error if the read fails.
+ * @return          The count of read bytes, less than the buffer size at the end of the file.
+ */
+inline std::size_t read_file(int fd, std::uint64_t offset, std::span<std::byte> bytes)
+{
+#if defined(__unix__) || defined(__APPLE__)
+    std::size_t done = 0;
+    while (done < bytes.size())
+    {
+        ::iovec buffer { bytes.data() + done, bytes.size() - done };
+        const ::ssize_t count = ::preadv(fd, &buffer, 1, static_cast<::off_t>(offset + done));
+        if (count < 0)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+            raise_io_error(errno, "Failed to read the array from the file.");
+        }
+        if (0 == count)
+        {
+            break;
+        }
+        done += static_cast<std::size_t>(count);
+    }
+    return done;
+#else
+    (void) fd;
+    (void) offset;
+    (void) bytes;
+    raise_io_error(ENOSYS, "The file I/O of the arrays is not supported on this platform.");
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace ts::impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#endif // THREADSAFESMARTPOINTERS_TS_FILE_IO_H
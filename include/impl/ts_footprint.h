@@ -0,0 +1,618 @@
+#ifndef THREADSAFESMARTPOINTERS_TS_FOOTPRINT_H
+#define THREADSAFESMARTPOINTERS_TS_FOOTPRINT_H
+
+/**
+ * @file        ts_footprint.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the memory footprint accounting.
+ * @date        10/18/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
+#include "impl/ts_config.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace ts {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   The memory footprint of the objects of the managed type, owned by ts::shared_ptr and
+ *          ts::unique_ptr, and of their mutexes and control blocks.
+ */
+struct footprint
+{
+    std::size_t m_live_count = 0;
+
+    /**
+     * The static size of the live objects, the size of the arrays is known only if they are
+     * created by ts::make_shared and ts::make_unique.
+     */
+    std::size_t m_object_bytes = 0;
+
+    /**
+     * The dynamic size of the live objects reported by footprint_dynamic_size.
+     */
+    std::size_t m_dynamic_bytes = 0;
+
+    std::size_t m_mutex_count = 0;
+    std::size_t m_mutex_bytes = 0;
+    std::size_t m_control_block_bytes = 0;
+
+    std::size_t m_peak_live_count = 0;
+    std::size_t m_peak_bytes = 0;
+
+    [[nodiscard]] std::size_t total_bytes() const noexcept
+    {
+        return m_object_bytes + m_dynamic_bytes + m_mutex_bytes + m_control_block_bytes;
+    }
+};
+
+/**
+ * @brief   The footprint of the managed type in ts::footprint_report.
+ */
+struct footprint_entry
+{
+    std::string m_type_name {};
+    footprint m_footprint {};
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief       Checks the type reports its dynamic size by the customization point
+ *              std::size_t footprint_dynamic_size(const T&), found by ADL.
+ *
+ * @tparam T    The object type.
+ */
+template <typename T>
+concept has_dynamic_size = requires(const T& object)
+{
+    { footprint_dynamic_size(object) } -> std::convertible_to<std::size_t>;
+};
+
+template <typename T>
+std::size_t dynamic_size_of(const T& object)
+{
+    if constexpr (has_dynamic_size<T>)
+    {
+        return static_cast<std::size_t>(footprint_dynamic_size(object));
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @internal
+ * @brief   Gets the readable name of the type.
+ */
+template <typename T>
+std::string type_name_of()
+{
+    const char* name = typeid(T).name();
+#if defined(__GNUG__)
+    int status = 0;
+    std::unique_ptr<char, decltype(&std::free)> p_demangled {
+        abi::__cxa_demangle(name, nullptr, nullptr, &status), &std::free };
+    if (0 == status && nullptr != p_demangled)
+    {
+        return p_demangled.get();
+    }
+#endif
+    return name;
+}
+
+/**
+ * @internal
+ * @brief   The accounting of the single object, kept by the owner of the object.
+ */
+struct footprint_record
+{
+    std::size_t m_object_bytes = 0;
+    std::size_t m_dynamic_bytes = 0;
+    bool m_is_adopted = false;
+};
+
+/**
+ * @internal
+ *
+ * @class       footprint_counters
+ * @brief       The footprint counters of the managed type.
+ */
+class footprint_counters
+{
+public:
+    explicit footprint_counters(std::string type_name)
+        : m_type_name(std::move(type_name))
+    {
+    }
+
+    footprint_counters(const footprint_counters&) = delete;
+    footprint_counters(footprint_counters&&) = delete;
+    footprint_counters& operator=(const footprint_counters&) = delete;
+    footprint_counters& operator=(footprint_counters&&) = delete;
+
+    void add_object(const footprint_record& record) noexcept
+    {
+        const std::size_t live_count = m_live_count.fetch_add(1, std::memory_order_relaxed) + 1;
+        m_object_bytes.fetch_add(record.m_object_bytes, std::memory_order_relaxed);
+        m_dynamic_bytes.fetch_add(record.m_dynamic_bytes, std::memory_order_relaxed);
+        update_peak(m_peak_live_count, live_count);
+        update_peak_bytes();
+    }
+
+    void remove_object(const footprint_record& record) noexcept
+    {
+        m_live_count.fetch_sub(1, std::memory_order_relaxed);
+        m_object_bytes.fetch_sub(record.m_object_bytes, std::memory_order_relaxed);
+        m_dynamic_bytes.fetch_sub(record.m_dynamic_bytes, std::memory_order_relaxed);
+    }
+
+    void resize_object(std::size_t old_dynamic_bytes, std::size_t new_dynamic_bytes) noexcept
+    {
+        m_dynamic_bytes.fetch_add(new_dynamic_bytes - old_dynamic_bytes
+                , std::memory_order_relaxed);
+        update_peak_bytes();
+    }
+
+    /**
+     * @brief   Counts the allocation of the mutex, of the control block, or of both of them in the
+     *          single block.
+     */
+    void add_block(std::size_t mutex_bytes, std::size_t control_block_bytes) noexcept
+    {
+        if (0 != mutex_bytes)
+        {
+            m_mutex_count.fetch_add(1, std::memory_order_relaxed);
+            m_mutex_bytes.fetch_add(mutex_bytes, std::memory_order_relaxed);
+        }
+        m_control_block_bytes.fetch_add(control_block_bytes, std::memory_order_relaxed);
+        update_peak_bytes();
+    }
+
+    void remove_block(std::size_t mutex_bytes, std::size_t control_block_bytes) noexcept
+    {
+        if (0 != mutex_bytes)
+        {
+            m_mutex_count.fetch_sub(1, std::memory_order_relaxed);
+            m_mutex_bytes.fetch_sub(mutex_bytes, std::memory_order_relaxed);
+        }
+        m_control_block_bytes.fetch_sub(control_block_bytes, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] const std::string& type_name() const noexcept
+    {
+        return m_type_name;
+    }
+
+    [[nodiscard]] footprint snapshot() const noexcept
+    {
+        footprint result {};
+        result.m_live_count = m_live_count.load(std::memory_order_relaxed);
+        result.m_object_bytes = m_object_bytes.load(std::memory_order_relaxed);
+        result.m_dynamic_bytes = m_dynamic_bytes.load(std::memory_order_relaxed);
+        result.m_mutex_count = m_mutex_count.load(std::memory_order_relaxed);
+        result.m_mutex_bytes = m_mutex_bytes.load(std::memory_order_relaxed);
+        result.m_control_block_bytes = m_control_block_bytes.load(std::memory_order_relaxed);
+        result.m_peak_live_count = m_peak_live_count.load(std::memory_order_relaxed);
+        result.m_peak_bytes = m_peak_bytes.load(std::memory_order_relaxed);
+        return result;
+    }
+
+private:
+    static void update_peak(std::atomic<std::size_t>& peak, std::size_t value) noexcept
+    {
+        std::size_t current = peak.load(std::memory_order_relaxed);
+        while (current < value && !peak.compare_exchange_weak(current, value
+                , std::memory_order_relaxed))
+        {
+        }
+    }
+
+    void update_peak_bytes() noexcept
+    {
+        update_peak(m_peak_bytes, m_object_bytes.load(std::memory_order_relaxed)
+                + m_dynamic_bytes.load(std::memory_order_relaxed)
+                + m_mutex_bytes.load(std::memory_order_relaxed)
+                + m_control_block_bytes.load(std::memory_order_relaxed));
+    }
+
+private:
+    const std::string m_type_name;
+    std::atomic<std::size_t> m_live_count { 0 };
+    std::atomic<std::size_t> m_object_bytes { 0 };
+    std::atomic<std::size_t> m_dynamic_bytes { 0 };
+    std::atomic<std::size_t> m_mutex_count { 0 };
+    std::atomic<std::size_t> m_mutex_bytes { 0 };
+    std::atomic<std::size_t> m_control_block_bytes { 0 };
+    std::atomic<std::size_t> m_peak_live_count { 0 };
+    std::atomic<std::size_t> m_peak_bytes { 0 };
+}; // class footprint_counters
+
+/**
+ * @internal
+ *
+ * @class       footprint_registry
+ * @brief       The list of the counters of all accounted types.
+ */
+class footprint_registry
+{
+public:
+    static footprint_registry& instance()
+    {
+        static footprint_registry s_registry {};
+        return s_registry;
+    }
+
+    void add(const footprint_counters* p_counters)
+    {
+        std::lock_guard lock { m_mtx };
+        m_counters.push_back(p_counters);
+    }
+
+    [[nodiscard]] std::vector<const footprint_counters*> counters() const
+    {
+        std::lock_guard lock { m_mtx };
+        return m_counters;
+    }
+
+private:
+    footprint_registry() = default;
+
+private:
+    mutable std::mutex m_mtx {};
+    std::vector<const footprint_counters*> m_counters {};
+}; // class footprint_registry
+
+/**
+ * @internal
+ * @brief   Gets the counters of the managed type. The counters are never destroyed, so the
+ *          static objects can be released at the exit.
+ */
+template <typename TKey>
+footprint_counters& footprint_counters_of()
+{
+    static footprint_counters& s_counters = []() -> footprint_counters&
+    {
+        auto* p_counters = new footprint_counters { type_name_of<TKey>() };
+        footprint_registry::instance().add(p_counters);
+        return *p_counters;
+    }();
+    return s_counters;
+}
+
+template <typename T>
+using t_footprint_key = std::remove_cv_t<T>;
+
+/**
+ * @internal
+ * @brief   Gets the static size of the object adopted by the raw pointer, the size of the array
+ *          is unknown.
+ */
+template <typename T, typename U>
+constexpr std::size_t object_bytes_of() noexcept
+{
+    return std::is_array_v<T> ? 0 : sizeof(U);
+}
+
+/**
+ * @internal
+ * @brief   Starts the accounting of the object of the managed type TKey, if the pointer is not
+ *          null.
+ */
+template <typename TKey, typename U>
+footprint_record adopt_footprint(const U* p_object, std::size_t object_bytes)
+{
+    if (nullptr == p_object)
+    {
+        return {};
+    }
+    footprint_record record { object_bytes, 0, true };
+    if constexpr (!std::is_array_v<TKey>)
+    {
+        record.m_dynamic_bytes = dynamic_size_of(static_cast<const TKey&>(*p_object));
+    }
+    footprint_counters_of<TKey>().add_object(record);
+    return record;
+}
+
+/**
+ * @internal
+ * @brief   Samples the dynamic size of the accounted object again.
+ */
+template <typename TKey, typename U>
+void update_footprint(footprint_record& record, const U& object)
+{
+    if constexpr (!std::is_array_v<TKey>)
+    {
+        if (record.m_is_adopted)
+        {
+            const std::size_t dynamic_bytes = dynamic_size_of(static_cast<const TKey&>(object));
+            footprint_counters_of<TKey>().resize_object(record.m_dynamic_bytes, dynamic_bytes);
+            record.m_dynamic_bytes = dynamic_bytes;
+        }
+    }
+}
+
+/**
+ * @internal
+ *
+ * @class       footprint_allocator
+ * @brief       The allocator of the control blocks of std::shared_ptr, counts the allocated
+ *              bytes. If the payload is given the block holds it, e.g. the mutex of
+ *              ts::shared_ptr allocated by std::allocate_shared.
+ */
+template <typename U, typename TKey, typename TPayload = void>
+class footprint_allocator
+{
+public:
+    using value_type = U;
+
+    template <typename V>
+    struct rebind
+    {
+        using other = footprint_allocator<V, TKey, TPayload>;
+    };
+
+public:
+    footprint_allocator() = default;
+
+    template <typename V>
+    explicit(false) footprint_allocator(const footprint_allocator<V, TKey, TPayload>&) noexcept
+    {
+    }
+
+    U* allocate(std::size_t count)
+    {
+        U* p_block = std::allocator<U> {}.allocate(count);
+        footprint_counters_of<TKey>().add_block(s_payload_bytes
+                , count * sizeof(U) - s_payload_bytes);
+        return p_block;
+    }
+
+    void deallocate(U* p_block, std::size_t count) noexcept
+    {
+        footprint_counters_of<TKey>().remove_block(s_payload_bytes
+                , count * sizeof(U) - s_payload_bytes);
+        std::allocator<U> {}.deallocate(p_block, count);
+    }
+
+    friend bool operator==(const footprint_allocator&, const footprint_allocator&) noexcept
+    {
+        return true;
+    }
+
+private:
+    static constexpr std::size_t s_payload_bytes = []()
+    {
+        if constexpr (std::is_void_v<TPayload>)
+        {
+            return std::size_t { 0 };
+        }
+        else
+        {
+            return sizeof(TPayload);
+        }
+    }();
+}; // class footprint_allocator
+
+/**
+ * @internal
+ *
+ * @class       footprint_deleter
+ * @brief       The deleter of the objects of ts::shared_ptr, keeps the accounting of the object
+ *              until its deletion. The adopted pointer is kept, so the derived object is deleted
+ *              by its own type.
+ */
+template <typename TKey>
+class footprint_deleter
+{
+public:
+    template <typename U>
+    footprint_deleter(const U* p_object, footprint_record record) noexcept
+        : m_p_object(p_object)
+        , m_delete(&delete_object<U>)
+        , m_record(record)
+    {
+    }
+
+    template <typename U>
+    void operator()(U*) noexcept
+    {
+        if (m_record.m_is_adopted)
+        {
+            footprint_counters_of<TKey>().remove_object(m_record);
+        }
+        m_delete(m_p_object);
+    }
+
+    [[nodiscard]] footprint_record& record() noexcept
+    {
+        return m_record;
+    }
+
+private:
+    template <typename U>
+    static void delete_object(const void* p_object) noexcept
+    {
+        if constexpr (std::is_array_v<TKey>)
+        {
+            delete[] static_cast<const U*>(p_object);
+        }
+        else
+        {
+            delete static_cast<const U*>(p_object);
+        }
+    }
+
+private:
+    const void* m_p_object;
+    void (*m_delete)(const void*) noexcept;
+    footprint_record m_record;
+}; // class footprint_deleter
+
+/**
+ * @internal
+ * @brief   Creates the accounted std::shared_ptr from the raw pointer, counts the object, the
+ *          control block and the dynamic size.
+ */
+template <typename T, typename U>
+std::shared_ptr<T> make_footprint_data(U* p_object, std::size_t object_bytes)
+{
+    using t_key = t_footprint_key<T>;
+    return std::shared_ptr<T>(p_object
+            , footprint_deleter<t_key> { p_object, adopt_footprint<t_key>(p_object, object_bytes) }
+            , footprint_allocator<char, t_key> {});
+}
+
+/**
+ * @internal
+ *
+ * @class       footprint_member
+ * @brief       The accounting member of ts::unique_ptr: counts the embedded mutex for the life of
+ *              the pointer and the owned object until its release.
+ */
+template <typename TKey, typename TMutex>
+class footprint_member
+{
+public:
+    footprint_member() noexcept
+    {
+        footprint_counters_of<TKey>().add_block(sizeof(TMutex), 0);
+    }
+
+    footprint_member(const footprint_member&) noexcept
+        : footprint_member()
+    {
+    }
+
+    footprint_member& operator=(const footprint_member&) noexcept
+    {
+        return *this;
+    }
+
+    ~footprint_member()
+    {
+        release();
+        footprint_counters_of<TKey>().remove_block(sizeof(TMutex), 0);
+    }
+
+    template <typename U>
+    void adopt(const U* p_object, std::size_t object_bytes)
+    {
+        release();
+        m_record = adopt_footprint<TKey>(p_object, object_bytes);
+    }
+
+    void release() noexcept
+    {
+        if (m_record.m_is_adopted)
+        {
+            footprint_counters_of<TKey>().remove_object(m_record);
+            m_record = {};
+        }
+    }
+
+    void take(footprint_member& other) noexcept
+    {
+        release();
+        m_record = std::exchange(other.m_record, {});
+    }
+
+    template <typename U>
+    void update(const U& object)
+    {
+        impl::update_footprint<TKey>(m_record, object);
+    }
+
+private:
+    footprint_record m_record {};
+}; // class footprint_member
+
+/**
+ * @internal
+ * @brief   The empty accounting member of ts::unique_ptr, used if the accounting is disabled.
+ */
+struct disabled_footprint_member
+{
+    template <typename U>
+    void adopt(const U*, std::size_t) noexcept
+    {
+    }
+
+    void release() noexcept
+    {
+    }
+
+    void take(disabled_footprint_member&) noexcept
+    {
+    }
+
+    template <typename U>
+    void update(const U&) noexcept
+    {
+    }
+};
+
+template <typename T, typename TMutex>
+using t_footprint_member = std::conditional_t<config::s_track_footprint
+        , footprint_member<t_footprint_key<T>, TMutex>, disabled_footprint_member>;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief       Gets the footprint of the managed type. The footprint is accounted only if
+ *              THREADSAFESMARTPOINTERS_TRACK_FOOTPRINT is defined.
+ *
+ * @example     auto orders = ts::footprint_of<order_book>();
+ *              auto lock_overhead = orders.m_mutex_bytes + orders.m_control_block_bytes;
+ * @tparam T    The managed type.
+ */
+template <typename T>
+footprint footprint_of()
+{
+    return impl::footprint_counters_of<impl::t_footprint_key<T>>().snapshot();
+}
+
+/**
+ * @brief   Gets the footprints of all managed types accounted so far.
+ */
+inline std::vector<footprint_entry> footprint_report()
+{
+    std::vector<footprint_entry> report;
+    for (const impl::footprint_counters* p_counters
+            : impl::footprint_registry::instance().counters())
+    {
+        report.push_back(footprint_entry { p_counters->type_name(), p_counters->snapshot() });
+    }
+    return report;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace ts
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#endif // THREADSAFESMARTPOINTERS_TS_FOOTPRINT_H
@@ -0,0 +1,1036 @@
+#ifndef THREADSAFESMARTPOINTERS_TS_INSTRUMENTATION_H
+#define THREADSAFESMARTPOINTERS_TS_INSTRUMENTATION_H
+
+/**
+ * @file        ts_instrumentation.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the lock instrumentation probe.
+ * @date        10/18/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if defined(__GLIBC__) || defined(__APPLE__)
+#include <execinfo.h>
+#endif
+
+#include "impl/ts_config.h"
+#include "impl/ts_random.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace ts::impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @internal
+ * @brief   The access mode of the lock acquisition.
+ */
+enum class access_mode : std::uint8_t
+{
+    exclusive = 0,
+    shared = 1
+};
+
+/**
+ * @internal
+ * @brief   The compact record of the single lock acquisition. The timestamp is the time of the
+ *          lock request, the durations are saturated to 4 seconds.
+ */
+struct lock_event
+{
+    std::uint64_t m_timestamp_ns = 0;
+    std::uint64_t m_mutex_id = 0;
+    std::uint32_t m_wait_ns = 0;
+    std::uint32_t m_hold_ns = 0;
+    std::uint32_t m_thread = 0;
+    access_mode m_mode = access_mode::exclusive;
+};
+
+/**
+ * @internal
+ * @brief   Gets the monotonic time in nanoseconds.
+ */
+inline std::uint64_t now_ns() noexcept
+{
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/**
+ * @internal
+ * @brief   Gets the sequential index of the current thread.
+ */
+inline std::uint32_t this_thread_index() noexcept
+{
+    static std::atomic<std::uint32_t> s_next_index { 0 };
+    static thread_local const std::uint32_t s_index
+            = s_next_index.fetch_add(1, std::memory_order_relaxed);
+    return s_index;
+}
+
+inline std::uint32_t saturate_ns(std::uint64_t duration) noexcept
+{
+    return static_cast<std::uint32_t>(std::min<std::uint64_t>(duration
+            , std::numeric_limits<std::uint32_t>::max()));
+}
+
+/**
+ * @internal
+ *
+ * @class       thread_buffer_pool
+ * @brief       The per-thread buffers of the sink, owned by the pool.
+ *
+ * @details     The thread takes the buffer on the first use and returns it to the pool when it
+ *              finishes, the next new thread reuses it, so the count of the buffers is bounded
+ *              by the peak count of the threads. The sinks merge the data of the buffer (the
+ *              events, the samples, the stack weights), so the data of the finished thread stays
+ *              until it's drained by the collection and the next owner adds to it.
+ * @tparam TBuffer  The buffer type, the buffer is guarded by the sink.
+ */
+template <typename TBuffer>
+class thread_buffer_pool
+{
+    struct lease
+    {
+        thread_buffer_pool* m_p_pool = nullptr;
+        TBuffer* m_p_buffer = nullptr;
+
+        ~lease()
+        {
+            if (nullptr != m_p_buffer)
+            {
+                m_p_pool->release(*m_p_buffer);
+            }
+        }
+    };
+
+public:
+    thread_buffer_pool() = default;
+
+    /**
+     * Prevent copying and moving of an object.
+     */
+    thread_buffer_pool(const thread_buffer_pool&) = delete;
+    thread_buffer_pool(thread_buffer_pool&&) = delete;
+    thread_buffer_pool& operator=(const thread_buffer_pool&) = delete;
+    thread_buffer_pool& operator=(thread_buffer_pool&&) = delete;
+
+    /**
+     * @brief   Gets the buffer of the current thread, takes the released buffer or allocates the
+     *          new one on the first call of the thread.
+     */
+    TBuffer& local()
+    {
+        static thread_local lease s_lease {};
+        if (nullptr == s_lease.m_p_buffer)
+        {
+            s_lease.m_p_pool = this;
+            s_lease.m_p_buffer = &acquire();
+        }
+        return *s_lease.m_p_buffer;
+    }
+
+    /**
+     * @brief   Invokes the function with every buffer, the buffers are not taken or returned
+     *          during the call.
+     */
+    template <typename TFunc>
+    void for_each(TFunc&& func) const
+    {
+        std::lock_guard lock { m_mtx };
+        for (const auto& p_buffer : m_buffers)
+        {
+            func(*p_buffer);
+        }
+    }
+
+    /**
+     * @brief   Gets the position of the buffer, starting from 1, the position doesn't change
+     *          after the reuse.
+     */
+    [[nodiscard]] std::uint32_t index_of(const TBuffer& target) const
+    {
+        std::lock_guard lock { m_mtx };
+        const auto it = std::ranges::find(m_buffers, &target, &std::unique_ptr<TBuffer>::get);
+        return static_cast<std::uint32_t>(std::distance(m_buffers.begin(), it) + 1);
+    }
+
+    /**
+     * @brief   Gets the buffer by the position, nullptr if there is no such buffer.
+     */
+    [[nodiscard]] TBuffer* at(std::uint32_t index) const
+    {
+        std::lock_guard lock { m_mtx };
+        return (0 == index || index > m_buffers.size()) ? nullptr : m_buffers[index - 1].get();
+    }
+
+private:
+    TBuffer& acquire()
+    {
+        std::lock_guard lock { m_mtx };
+        if (m_free.empty())
+        {
+            return *m_buffers.emplace_back(std::make_unique<TBuffer>());
+        }
+        TBuffer* p_buffer = m_free.back();
+        m_free.pop_back();
+        return *p_buffer;
+    }
+
+    void release(TBuffer& released)
+    {
+        std::lock_guard lock { m_mtx };
+        m_free.push_back(&released);
+    }
+
+private:
+    mutable std::mutex m_mtx {};
+    std::vector<std::unique_ptr<TBuffer>> m_buffers {};
+    std::vector<TBuffer*> m_free {};
+}; // class thread_buffer_pool
+
+/**
+ * @internal
+ *
+ * @class       lock_trace_sink
+ * @brief       Collects the lock events to the per-thread buffers while the recording is active.
+ *
+ * @details     The thread appends to its own buffer, the buffer mutex is contended only by the
+ *              collection. The buffers are owned by the pool, so the events of the finished
+ *              threads are kept until the collection, and their buffers are reused.
+ */
+class lock_trace_sink
+{
+    struct buffer
+    {
+        std::mutex m_mtx {};
+        std::vector<lock_event> m_events {};
+    };
+
+public:
+    static lock_trace_sink& instance()
+    {
+        static lock_trace_sink s_sink {};
+        return s_sink;
+    }
+
+    [[nodiscard]] bool is_active() const noexcept
+    {
+        return m_is_active.load(std::memory_order_relaxed);
+    }
+
+    void start()
+    {
+        m_buffers.for_each([](buffer& target)
+        {
+            std::lock_guard buffer_lock { target.m_mtx };
+            target.m_events.clear();
+        });
+        m_is_active.store(true, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief   Stops the recording and moves out the events of all threads, ordered by the
+     *          timestamp.
+     */
+    std::vector<lock_event> stop()
+    {
+        m_is_active.store(false, std::memory_order_relaxed);
+        std::vector<lock_event> events;
+        m_buffers.for_each([&events](buffer& target)
+        {
+            std::lock_guard buffer_lock { target.m_mtx };
+            events.insert(events.end(), target.m_events.begin(), target.m_events.end());
+            target.m_events.clear();
+            target.m_events.shrink_to_fit();
+        });
+        std::ranges::stable_sort(events, {}, &lock_event::m_timestamp_ns);
+        return events;
+    }
+
+    void record(const lock_event& event)
+    {
+        buffer& local = m_buffers.local();
+        std::lock_guard lock { local.m_mtx };
+        local.m_events.push_back(event);
+    }
+
+private:
+    lock_trace_sink() = default;
+
+private:
+    std::atomic_bool m_is_active { false };
+    thread_buffer_pool<buffer> m_buffers {};
+}; // class lock_trace_sink
+
+/**
+ * @internal
+ *
+ * @class       contention_sink
+ * @brief       Enables the counting of the contended acquisitions while any
+ *              ts::contention_monitor is alive.
+ */
+class contention_sink
+{
+public:
+    static contention_sink& instance()
+    {
+        static contention_sink s_sink {};
+        return s_sink;
+    }
+
+    [[nodiscard]] bool is_active() const noexcept
+    {
+        return 0 != m_monitor_count.load(std::memory_order_relaxed);
+    }
+
+    void start() noexcept
+    {
+        m_monitor_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void stop() noexcept
+    {
+        m_monitor_count.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+private:
+    contention_sink() = default;
+
+private:
+    std::atomic<std::size_t> m_monitor_count { 0 };
+}; // class contention_sink
+
+/**
+ * @internal
+ * @brief   The lock accounting of the thread: the count of the acquisitions, the total wait and
+ *          hold durations.
+ */
+struct lock_accounting
+{
+    std::uint64_t m_acquisition_count = 0;
+    std::uint64_t m_wait_ns = 0;
+    std::uint64_t m_hold_ns = 0;
+};
+
+/**
+ * @internal
+ *
+ * @class       accounting_sink
+ * @brief       Accumulates the lock accounting of the current thread while any
+ *              ts::accounting_scope of the thread is alive.
+ *
+ * @details     The state is thread-local, so the accounting costs a few plain increments and
+ *              the threads without the scope are not timed at all.
+ */
+class accounting_sink
+{
+    struct state
+    {
+        std::uint32_t m_depth = 0;
+        lock_accounting m_totals {};
+    };
+
+public:
+    [[nodiscard]] static bool is_active() noexcept
+    {
+        return 0 != local().m_depth;
+    }
+
+    static void enter() noexcept
+    {
+        ++local().m_depth;
+    }
+
+    static void leave() noexcept
+    {
+        --local().m_depth;
+    }
+
+    /**
+     * @brief   Gets the totals of the thread, accumulated by all scopes of the thread.
+     */
+    [[nodiscard]] static const lock_accounting& totals() noexcept
+    {
+        return local().m_totals;
+    }
+
+    static void on_acquired(std::uint64_t wait_ns) noexcept
+    {
+        lock_accounting& totals = local().m_totals;
+        ++totals.m_acquisition_count;
+        totals.m_wait_ns += wait_ns;
+    }
+
+    static void on_released(std::uint64_t hold_ns) noexcept
+    {
+        local().m_totals.m_hold_ns += hold_ns;
+    }
+
+private:
+    static state& local() noexcept
+    {
+        static thread_local state s_state {};
+        return s_state;
+    }
+}; // class accounting_sink
+
+/**
+ * @internal
+ * @brief   The totals of the sampled acquisitions of the mutex.
+ */
+struct lock_samples
+{
+    std::uint64_t m_sample_count = 0;
+    std::uint64_t m_wait_ns = 0;
+    std::uint64_t m_hold_ns = 0;
+};
+
+/**
+ * @internal
+ *
+ * @class       lock_sampling_sink
+ * @brief       Samples the 1-in-N acquisitions of the instrumented mutexes while
+ *              ts::lock_sampler is alive, the samples are accumulated per mutex.
+ *
+ * @details     Each thread counts down its acquisitions, the countdown is drawn uniformly from
+ *              [1, 2N - 1], so the mean sampling period is N and the periodic access patterns do
+ *              not bias the samples. The samples are accumulated to the per-thread buffers like
+ *              the lock trace.
+ */
+class lock_sampling_sink
+{
+    struct buffer
+    {
+        std::mutex m_mtx {};
+        std::unordered_map<std::uint64_t, lock_samples> m_samples {};
+    };
+
+    struct local_state
+    {
+        std::uint64_t m_countdown = 0;
+        std::uint32_t m_generation = 0;
+        bool m_is_pending = false;
+    };
+
+public:
+    static lock_sampling_sink& instance()
+    {
+        static lock_sampling_sink s_sink {};
+        return s_sink;
+    }
+
+    [[nodiscard]] std::uint32_t period() const noexcept
+    {
+        return m_period.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief   Counts down the acquisition of the current thread.
+     *
+     * @return  true if the acquisition should be sampled.
+     */
+    bool tick() noexcept
+    {
+        const std::uint32_t period = m_period.load(std::memory_order_relaxed);
+        if (0 == period)
+        {
+            return false;
+        }
+        local_state& local = local_state_of();
+        // The countdown of the previous sampling with the other period is dropped.
+        const std::uint32_t generation = m_generation.load(std::memory_order_relaxed);
+        if (0 == local.m_countdown || generation != local.m_generation)
+        {
+            local.m_countdown = next_countdown(period);
+            local.m_generation = generation;
+        }
+        if (0 != --local.m_countdown)
+        {
+            return false;
+        }
+        local.m_countdown = next_countdown(period);
+        local.m_is_pending = true;
+        return true;
+    }
+
+    /**
+     * @brief   Checks the acquisition of the current thread was chosen by tick() and resets it.
+     */
+    static bool take_pending() noexcept
+    {
+        return std::exchange(local_state_of().m_is_pending, false);
+    }
+
+    void start(std::uint32_t period)
+    {
+        m_buffers.for_each([](buffer& target)
+        {
+            std::lock_guard buffer_lock { target.m_mtx };
+            target.m_samples.clear();
+        });
+        m_generation.fetch_add(1, std::memory_order_relaxed);
+        m_period.store(std::max<std::uint32_t>(1, period), std::memory_order_relaxed);
+    }
+
+    void stop() noexcept
+    {
+        m_period.store(0, std::memory_order_relaxed);
+    }
+
+    void record(std::uint64_t mutex_id, std::uint64_t wait_ns, std::uint64_t hold_ns)
+    {
+        buffer& local = m_buffers.local();
+        std::lock_guard lock { local.m_mtx };
+        lock_samples& samples = local.m_samples[mutex_id];
+        ++samples.m_sample_count;
+        samples.m_wait_ns += wait_ns;
+        samples.m_hold_ns += hold_ns;
+    }
+
+    /**
+     * @brief   Gets the samples of all threads merged per mutex.
+     */
+    [[nodiscard]] std::unordered_map<std::uint64_t, lock_samples> collect() const
+    {
+        std::unordered_map<std::uint64_t, lock_samples> result;
+        m_buffers.for_each([&result](buffer& target)
+        {
+            std::lock_guard buffer_lock { target.m_mtx };
+            for (const auto& [mutex_id, samples] : target.m_samples)
+            {
+                lock_samples& total = result[mutex_id];
+                total.m_sample_count += samples.m_sample_count;
+                total.m_wait_ns += samples.m_wait_ns;
+                total.m_hold_ns += samples.m_hold_ns;
+            }
+        });
+        return result;
+    }
+
+private:
+    lock_sampling_sink() = default;
+
+    static local_state& local_state_of() noexcept
+    {
+        static thread_local local_state s_local {};
+        return s_local;
+    }
+
+    static std::uint64_t next_countdown(std::uint32_t period) noexcept
+    {
+        return 1 + thread_local_random(2 * std::size_t { period } - 1);
+    }
+
+private:
+    std::atomic<std::uint32_t> m_period { 0 };
+    std::atomic<std::uint32_t> m_generation { 0 };
+    thread_buffer_pool<buffer> m_buffers {};
+}; // class lock_sampling_sink
+
+/**
+ * @internal
+ * @brief   The return addresses of the call stack, the innermost frame first.
+ */
+struct stack_trace
+{
+    static constexpr std::size_t s_max_depth = 32;
+
+    std::array<void*, s_max_depth> m_frames {};
+    std::size_t m_depth = 0;
+
+    [[nodiscard]] std::vector<void*> frames() const
+    {
+        return std::vector<void*>(m_frames.begin()
+                , m_frames.begin() + static_cast<std::ptrdiff_t>(m_depth));
+    }
+};
+
+/**
+ * @internal
+ * @brief   Captures the call stack of the current thread, the stack is empty if the platform
+ *          doesn't provide backtrace().
+ */
+inline stack_trace capture_stack() noexcept
+{
+    stack_trace trace {};
+#if defined(__GLIBC__) || defined(__APPLE__)
+    const int depth = ::backtrace(trace.m_frames.data(), static_cast<int>(trace.m_frames.size()));
+    trace.m_depth = static_cast<std::size_t>(std::max(depth, 0));
+#endif
+    return trace;
+}
+
+/**
+ * @internal
+ *
+ * @class       contention_stack_sink
+ * @brief       Aggregates the stacks of the contended acquisitions while ts::contention_profiler
+ *              is alive: the stack of the waiter and optionally the stack of the last exclusive
+ *              holder, weighted by the wait duration.
+ *
+ * @details     The stacks are aggregated to the per-thread buffers like the lock trace. The
+ *              holder keeps its stack in the few slots of its own buffer, under the uncontended
+ *              lock of the buffer, and the mutex keeps only the index of the buffer. The waiter
+ *              which blocked finds the holder stack by the index.
+ */
+class contention_stack_sink
+{
+public:
+    /**
+     * @internal
+     * @brief   The waiter and the holder stacks, the holder stack is empty if it's unknown.
+     */
+    using key_type = std::pair<std::vector<void*>, std::vector<void*>>;
+
+    /**
+     * @internal
+     * @brief   The count and the total wait duration of the contended acquisitions.
+     */
+    struct weight
+    {
+        std::uint64_t m_count = 0;
+        std::uint64_t m_wait_ns = 0;
+    };
+
+private:
+    static constexpr std::size_t s_holder_slot_count = 4;
+
+    struct holder_slot
+    {
+        const void* m_mutex = nullptr;
+        stack_trace m_stack {};
+    };
+
+    struct buffer
+    {
+        std::mutex m_mtx {};
+        std::map<key_type, weight> m_stacks {};
+        std::array<holder_slot, s_holder_slot_count> m_holders {};
+        std::size_t m_next_holder = 0;
+        std::uint32_t m_index = 0;
+    };
+
+public:
+    static contention_stack_sink& instance()
+    {
+        static contention_stack_sink s_sink {};
+        return s_sink;
+    }
+
+    [[nodiscard]] bool is_active() const noexcept
+    {
+        return m_is_active.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] bool captures_holders() const noexcept
+    {
+        return m_captures_holders.load(std::memory_order_relaxed);
+    }
+
+    void start(bool capture_holders)
+    {
+        m_buffers.for_each([](buffer& target)
+        {
+            std::lock_guard buffer_lock { target.m_mtx };
+            target.m_stacks.clear();
+            target.m_holders.fill(holder_slot {});
+        });
+        m_captures_holders.store(capture_holders, std::memory_order_relaxed);
+        m_is_active.store(true, std::memory_order_relaxed);
+    }
+
+    void stop() noexcept
+    {
+        m_is_active.store(false, std::memory_order_relaxed);
+    }
+
+    void record(const stack_trace& waiter, std::vector<void*> holder, std::uint64_t wait_ns)
+    {
+        key_type key { waiter.frames(), std::move(holder) };
+        buffer& local = m_buffers.local();
+        std::lock_guard lock { local.m_mtx };
+        weight& total = local.m_stacks[std::move(key)];
+        ++total.m_count;
+        total.m_wait_ns += wait_ns;
+    }
+
+    /**
+     * @brief   Keeps the stack of the exclusive holder of the mutex in the buffer of the current
+     *          thread, replaces the oldest slot if the thread holds more mutexes.
+     *
+     * @return  The index of the buffer to keep in the mutex, never 0.
+     */
+    std::uint32_t set_holder_stack(const void* p_mutex, const stack_trace& holder)
+    {
+        buffer& local = m_buffers.local();
+        if (0 == local.m_index)
+        {
+            local.m_index = m_buffers.index_of(local);
+        }
+        std::lock_guard lock { local.m_mtx };
+        auto slot = std::ranges::find(local.m_holders, p_mutex, &holder_slot::m_mutex);
+        if (slot == local.m_holders.end())
+        {
+            slot = local.m_holders.begin()
+                    + static_cast<std::ptrdiff_t>(local.m_next_holder++ % s_holder_slot_count);
+        }
+        *slot = holder_slot { p_mutex, holder };
+        return local.m_index;
+    }
+
+    /**
+     * @brief   Gets the stack of the last exclusive holder of the mutex from the buffer of the
+     *          holder thread, empty if it's unknown or was replaced.
+     */
+    [[nodiscard]] std::vector<void*> holder_stack_of(const void* p_mutex
+            , std::uint32_t buffer_index) const
+    {
+        buffer* p_holder_buffer = m_buffers.at(buffer_index);
+        if (nullptr == p_holder_buffer)
+        {
+            return {};
+        }
+        std::lock_guard lock { p_holder_buffer->m_mtx };
+        const auto slot = std::ranges::find(p_holder_buffer->m_holders, p_mutex
+                , &holder_slot::m_mutex);
+        return slot != p_holder_buffer->m_holders.end()
+                ? slot->m_stack.frames()
+                : std::vector<void*> {};
+    }
+
+    /**
+     * @brief   Gets the stacks of all threads merged.
+     */
+    [[nodiscard]] std::map<key_type, weight> collect() const
+    {
+        std::map<key_type, weight> result;
+        m_buffers.for_each([&result](buffer& target)
+        {
+            std::lock_guard buffer_lock { target.m_mtx };
+            for (const auto& [key, stack_weight] : target.m_stacks)
+            {
+                weight& total = result[key];
+                total.m_count += stack_weight.m_count;
+                total.m_wait_ns += stack_weight.m_wait_ns;
+            }
+        });
+        return result;
+    }
+
+private:
+    contention_stack_sink() = default;
+
+private:
+    std::atomic_bool m_is_active { false };
+    std::atomic_bool m_captures_holders { false };
+    thread_buffer_pool<buffer> m_buffers {};
+}; // class contention_stack_sink
+
+class mutex_diagnostics;
+
+/**
+ * @internal
+ *
+ * @class       mutex_registry
+ * @brief       The registry of the named or contended instrumented mutexes, the source of the
+ *              diagnostic reports. The uncontended unnamed mutexes are never registered.
+ */
+class mutex_registry
+{
+public:
+    /**
+     * @internal
+     * @brief   The snapshot of the registered mutex.
+     */
+    struct entry
+    {
+        std::string m_name {};
+        std::uintptr_t m_address = 0;
+        std::uint64_t m_contention_count = 0;
+    };
+
+public:
+    static mutex_registry& instance()
+    {
+        static mutex_registry s_registry {};
+        return s_registry;
+    }
+
+    void add(const mutex_diagnostics* p_diagnostics)
+    {
+        std::lock_guard lock { m_mtx };
+        (void) m_names.try_emplace(p_diagnostics);
+    }
+
+    void set_name(const mutex_diagnostics* p_diagnostics, std::string name)
+    {
+        std::lock_guard lock { m_mtx };
+        m_names[p_diagnostics] = std::move(name);
+    }
+
+    void remove(const mutex_diagnostics* p_diagnostics)
+    {
+        std::lock_guard lock { m_mtx };
+        m_names.erase(p_diagnostics);
+    }
+
+    /**
+     * @brief   Gets the snapshot of all registered mutexes.
+     */
+    [[nodiscard]] std::vector<entry> entries() const;
+
+private:
+    mutex_registry() = default;
+
+private:
+    mutable std::mutex m_mtx {};
+    std::unordered_map<const mutex_diagnostics*, std::string> m_names {};
+}; // class mutex_registry
+
+/**
+ * @internal
+ *
+ * @class       mutex_diagnostics
+ * @brief       The diagnostic state of the instrumented mutex: the address of the underlying
+ *              mutex, the count of the contended acquisitions and the registration.
+ *
+ * @details     The mutex is registered on the first contended acquisition or on naming, so the
+ *              construction of the uncontended mutexes never touches the global registry.
+ */
+class mutex_diagnostics
+{
+public:
+    explicit mutex_diagnostics(const void* p_mutex) noexcept
+        : m_address(reinterpret_cast<std::uintptr_t>(p_mutex))
+    {
+    }
+
+    ~mutex_diagnostics()
+    {
+        if (m_is_registered.load(std::memory_order_acquire))
+        {
+            mutex_registry::instance().remove(this);
+        }
+    }
+
+    mutex_diagnostics(const mutex_diagnostics&) = delete;
+    mutex_diagnostics(mutex_diagnostics&&) = delete;
+    mutex_diagnostics& operator=(const mutex_diagnostics&) = delete;
+    mutex_diagnostics& operator=(mutex_diagnostics&&) = delete;
+
+    /**
+     * @brief   Counts the acquisition which found the mutex locked.
+     */
+    void on_contended()
+    {
+        m_contention_count.fetch_add(1, std::memory_order_relaxed);
+        if (!m_is_registered.load(std::memory_order_relaxed)
+                && !m_is_registered.exchange(true, std::memory_order_acq_rel))
+        {
+            mutex_registry::instance().add(this);
+        }
+    }
+
+    void set_name(std::string name)
+    {
+        mutex_registry::instance().set_name(this, std::move(name));
+        m_is_registered.store(true, std::memory_order_release);
+    }
+
+    [[nodiscard]] std::uintptr_t address() const noexcept
+    {
+        return m_address;
+    }
+
+    [[nodiscard]] std::uint64_t contention_count() const noexcept
+    {
+        return m_contention_count.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief   Records the stack of the contended acquisition for the contention profile, called
+     *          by the waiter after the acquisition, before on_exclusive_acquired().
+     */
+    void on_contended_acquired(std::uint64_t request_ns)
+    {
+        if constexpr (config::s_profile_contention)
+        {
+            auto& sink = contention_stack_sink::instance();
+            if (sink.is_active())
+            {
+                const std::uint32_t holder_buffer = m_holder_buffer.load(std::memory_order_relaxed);
+                sink.record(capture_stack(), sink.captures_holders()
+                        ? sink.holder_stack_of(this, holder_buffer)
+                        : std::vector<void*> {}, now_ns() - request_ns);
+            }
+        }
+    }
+
+    /**
+     * @brief   Records the stack of the exclusive holder for the contention profile, called after
+     *          the exclusive acquisition. The shared holders are not recorded.
+     */
+    void on_exclusive_acquired()
+    {
+        if constexpr (config::s_profile_contention)
+        {
+            auto& sink = contention_stack_sink::instance();
+            if (sink.is_active() && sink.captures_holders())
+            {
+                m_holder_buffer.store(sink.set_holder_stack(this, capture_stack())
+                        , std::memory_order_relaxed);
+            }
+        }
+    }
+
+private:
+    const std::uintptr_t m_address;
+    std::atomic<std::uint64_t> m_contention_count { 0 };
+    std::atomic_bool m_is_registered { false };
+    std::atomic<std::uint32_t> m_holder_buffer { 0 };
+}; // class mutex_diagnostics
+
+inline std::vector<mutex_registry::entry> mutex_registry::entries() const
+{
+    std::lock_guard lock { m_mtx };
+    std::vector<entry> result;
+    result.reserve(m_names.size());
+    for (const auto& [p_diagnostics, name] : m_names)
+    {
+        result.push_back(entry { name, p_diagnostics->address()
+                , p_diagnostics->contention_count() });
+    }
+    return result;
+}
+
+/**
+ * @internal
+ *
+ * @class       lock_probe
+ * @brief       The hooks of the instrumented mutexes, measures the wait and hold durations of
+ *              the acquisitions and dispatches the events to the active sinks.
+ *
+ * @details     The acquisitions held by the thread are kept in the thread-local list, so the
+ *              release of the shared lock finds its own acquisition. The probe is inactive if
+ *              there is no active sink, then the mutex is not timed at all.
+ */
+class lock_probe
+{
+    struct held_lock
+    {
+        const void* m_mutex = nullptr;
+        std::uint64_t m_request_ns = 0;
+        std::uint64_t m_acquired_ns = 0;
+        access_mode m_mode = access_mode::exclusive;
+        bool m_is_sampled = false;
+    };
+
+public:
+    /**
+     * @brief   Checks the acquisition should be timed. Counts down the acquisition if the
+     *          sampling is active, so it should be called once per acquisition.
+     */
+    [[nodiscard]] static bool is_active() noexcept
+    {
+        // The countdown is ticked even if the other sinks are active, so the sampling doesn't
+        // stop while they are active.
+        const bool is_sampled = lock_sampling_sink::instance().tick();
+        return is_sampled || lock_trace_sink::instance().is_active()
+                || contention_sink::instance().is_active()
+                || (config::s_profile_contention && contention_stack_sink::instance().is_active())
+                || accounting_sink::is_active();
+    }
+
+    /**
+     * @brief   Drops the sample of the failed try-lock, so it isn't attributed to the next
+     *          acquisition.
+     */
+    static void on_failed() noexcept
+    {
+        (void) lock_sampling_sink::take_pending();
+    }
+
+    static void on_acquired(const void* mtx, access_mode mode, std::uint64_t request_ns
+            , std::uint64_t acquired_ns)
+    {
+        held().push_back(held_lock { mtx, request_ns, acquired_ns, mode
+                , lock_sampling_sink::take_pending() });
+        if (accounting_sink::is_active())
+        {
+            accounting_sink::on_acquired(acquired_ns - request_ns);
+        }
+    }
+
+    /**
+     * @brief   Records the release of the timed acquisition of the current thread.
+     *
+     * @return  true if the current thread holds the timed acquisition of the mutex, otherwise
+     *          false.
+     */
+    static bool on_released(const void* mtx)
+    {
+        auto& held_locks = held();
+        const auto it = std::find_if(held_locks.rbegin(), held_locks.rend()
+                , [mtx](const held_lock& lock) { return lock.m_mutex == mtx; });
+        if (it == held_locks.rend())
+        {
+            return false;
+        }
+        const held_lock lock = *it;
+        held_locks.erase(std::next(it).base());
+
+        const std::uint64_t released_ns = now_ns();
+        if (accounting_sink::is_active())
+        {
+            accounting_sink::on_released(released_ns - lock.m_acquired_ns);
+        }
+        const lock_event event {
+                lock.m_request_ns
+                , reinterpret_cast<std::uintptr_t>(mtx)
+                , saturate_ns(lock.m_acquired_ns - lock.m_request_ns)
+                , saturate_ns(released_ns - lock.m_acquired_ns)
+                , this_thread_index()
+                , lock.m_mode };
+        if (auto& trace_sink = lock_trace_sink::instance(); trace_sink.is_active())
+        {
+            trace_sink.record(event);
+        }
+        if (lock.m_is_sampled)
+        {
+            lock_sampling_sink::instance().record(event.m_mutex_id
+                    , lock.m_acquired_ns - lock.m_request_ns, released_ns - lock.m_acquired_ns);
+        }
+        return true;
+    }
+
+private:
+    static std::vector<held_lock>& held() noexcept
+    {
+        static thread_local std::vector<held_lock> s_held {};
+        return s_held;
+    }
+}; // class lock_probe
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace ts::impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#endif // THREADSAFESMARTPOINTERS_TS_INSTRUMENTATION_H
@@ -0,0 +1,303 @@
+#ifndef THREADSAFESMARTPOINTERS_TS_JOURNAL_H
+#define THREADSAFESMARTPOINTERS_TS_JOURNAL_H
+
+/**
+ * @file        ts_journal.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the journal and checkpoint files.
+ * @date        10/18/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+#include "impl/ts_config.h"
+#include "ts_journal_exception.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace ts::impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @internal
+ * @brief   The record of the journal, the serialized operation with its log sequence number.
+ */
+struct journal_record
+{
+    std::uint64_t m_lsn = 0;
+    std::string m_payload {};
+};
+
+/**
+ * @internal
+ * @brief   Throws ts::journal_exception, or terminates if the exceptions are disabled.
+ */
+[[noreturn]] inline void raise_journal_error(const std::string& message)
+{
+    if constexpr (config::s_enable_exceptions)
+    {
+        throw journal_exception { message };
+    }
+    else
+    {
+        std::terminate();
+    }
+}
+
+/**
+ * @internal
+ * @brief   The FNV-1a checksum of the record, detects the torn writes at the end of the file.
+ */
+inline std::uint32_t journal_checksum(std::uint64_t lsn, std::string_view payload) noexcept
+{
+    std::uint32_t hash = 2166136261u;
+    const auto mix = [&hash](unsigned char byte)
+    {
+        hash = (hash ^ byte) * 16777619u;
+    };
+    for (std::size_t i = 0; i < sizeof(lsn); ++i)
+    {
+        mix(static_cast<unsigned char>(lsn >> (8 * i)));
+    }
+    for (const char byte : payload)
+    {
+        mix(static_cast<unsigned char>(byte));
+    }
+    return hash;
+}
+
+/**
+ * @internal
+ * @brief   Flushes the stream buffer and the OS cache of the file to the device.
+ */
+inline void sync_file(std::FILE* file)
+{
+    if (0 != std::fflush(file))
+    {
+        raise_journal_error("Failed to flush the journal file.");
+    }
+#if defined(__unix__) || defined(__APPLE__)
+    if (0 != ::fsync(::fileno(file)))
+    {
+        raise_journal_error("Failed to sync the journal file.");
+    }
+#endif
+}
+
+/**
+ * @internal
+ * @brief   Writes the record: lsn, payload size, checksum and payload in the native byte order.
+ */
+inline bool write_record(std::FILE* file, std::uint64_t lsn, std::string_view payload)
+{
+    const auto size = static_cast<std::uint64_t>(payload.size());
+    const std::uint32_t checksum = journal_checksum(lsn, payload);
+    return 1 == std::fwrite(&lsn, sizeof(lsn), 1, file)
+            && 1 == std::fwrite(&size, sizeof(size), 1, file)
+            && 1 == std::fwrite(&checksum, sizeof(checksum), 1, file)
+            && payload.size() == std::fwrite(payload.data(), 1, payload.size(), file);
+}
+
+/**
+ * @internal
+ * @brief   Reads the record, returns std::nullopt at the end of the file or if the record is
+ *          incomplete or corrupted.
+ */
+inline std::optional<journal_record> read_record(std::istream& stream)
+{
+    journal_record record;
+    std::uint64_t size = 0;
+    std::uint32_t checksum = 0;
+    stream.read(reinterpret_cast<char*>(&record.m_lsn), sizeof(record.m_lsn));
+    stream.read(reinterpret_cast<char*>(&size), sizeof(size));
+    stream.read(reinterpret_cast<char*>(&checksum), sizeof(checksum));
+    if (!stream || size > (std::uint64_t { 1 } << 40))
+    {
+        return std::nullopt;
+    }
+    record.m_payload.resize(static_cast<std::size_t>(size));
+    stream.read(record.m_payload.data(), static_cast<std::streamsize>(size));
+    if (!stream || checksum != journal_checksum(record.m_lsn, record.m_payload))
+    {
+        return std::nullopt;
+    }
+    return record;
+}
+
+/**
+ * @internal
+ *
+ * @class       journal_file
+ * @brief       The append-only file of the journal records.
+ *
+ * @details     The records are appended by batches and synced once per batch (group commit).
+ *              The recovery reads the valid records and cuts the torn tail of the file.
+ */
+class journal_file
+{
+public:
+    explicit journal_file(std::filesystem::path path)
+        : m_path(std::move(path))
+    {
+        open("ab");
+    }
+
+    ~journal_file()
+    {
+        if (nullptr != m_file)
+        {
+            (void) std::fclose(m_file);
+        }
+    }
+
+    journal_file(const journal_file&) = delete;
+    journal_file(journal_file&&) = delete;
+    journal_file& operator=(const journal_file&) = delete;
+    journal_file& operator=(journal_file&&) = delete;
+
+    /**
+     * @brief   Appends the batch of the records and syncs the file.
+     */
+    void append(const std::vector<journal_record>& records)
+    {
+        for (const auto& record : records)
+        {
+            if (!write_record(m_file, record.m_lsn, record.m_payload))
+            {
+                raise_journal_error("Failed to write the journal file.");
+            }
+        }
+        sync_file(m_file);
+    }
+
+    /**
+     * @brief   Removes all records, called after the checkpoint which covers them.
+     */
+    void truncate()
+    {
+        (void) std::fclose(m_file);
+        m_file = nullptr;
+        open("wb");
+    }
+
+    /**
+     * @brief           Invokes the function for each valid record of the journal and cuts the
+     *                  invalid tail, so the new records are appended after the valid ones.
+     *
+     * @param path      The path of the journal file.
+     * @param func      The function invocable with const journal_record&.
+     */
+    template <typename TFunc>
+    static void replay(const std::filesystem::path& path, TFunc&& func)
+    {
+        std::error_code error;
+        if (!std::filesystem::exists(path, error))
+        {
+            return;
+        }
+        std::uintmax_t valid_size = 0;
+        {
+            std::ifstream stream { path, std::ios::binary };
+            while (auto record = read_record(stream))
+            {
+                func(std::as_const(*record));
+                valid_size = static_cast<std::uintmax_t>(stream.tellg());
+            }
+        }
+        if (std::filesystem::file_size(path, error) != valid_size)
+        {
+            std::filesystem::resize_file(path, valid_size, error);
+            if (error)
+            {
+                raise_journal_error("Failed to cut the torn tail of the journal file.");
+            }
+        }
+    }
+
+private:
+    void open(const char* mode)
+    {
+        m_file = std::fopen(m_path.string().c_str(), mode);
+        if (nullptr == m_file)
+        {
+            raise_journal_error("Failed to open the journal file " + m_path.string() + ".");
+        }
+    }
+
+private:
+    std::filesystem::path m_path;
+    std::FILE* m_file = nullptr;
+}; // class journal_file
+
+/**
+ * @internal
+ * @brief   Writes the checkpoint to the temporary file and atomically replaces the previous one.
+ */
+inline void write_checkpoint(const std::filesystem::path& path, std::uint64_t lsn
+        , std::string_view payload)
+{
+    auto temporary_path = path;
+    temporary_path += ".tmp";
+    std::FILE* file = std::fopen(temporary_path.string().c_str(), "wb");
+    if (nullptr == file)
+    {
+        raise_journal_error("Failed to open the checkpoint file " + temporary_path.string() + ".");
+    }
+    const bool is_written = write_record(file, lsn, payload);
+    try
+    {
+        sync_file(file);
+    }
+    catch (...)
+    {
+        (void) std::fclose(file);
+        throw;
+    }
+    (void) std::fclose(file);
+    if (!is_written)
+    {
+        raise_journal_error("Failed to write the checkpoint file.");
+    }
+    std::error_code error;
+    std::filesystem::rename(temporary_path, path, error);
+    if (error)
+    {
+        raise_journal_error("Failed to replace the checkpoint file " + path.string() + ".");
+    }
+}
+
+/**
+ * @internal
+ * @brief   Reads the checkpoint, returns std::nullopt if there is no valid checkpoint.
+ */
+inline std::optional<journal_record> read_checkpoint(const std::filesystem::path& path)
+{
+    std::ifstream stream { path, std::ios::binary };
+    if (!stream)
+    {
+        return std::nullopt;
+    }
+    return read_record(stream);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace ts::impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#endif // THREADSAFESMARTPOINTERS_TS_JOURNAL_H
@@ -0,0 +1,426 @@
+#ifndef THREADSAFESMARTPOINTERS_TS_JOURNALED_PTR_H
+#define THREADSAFESMARTPOINTERS_TS_JOURNALED_PTR_H
+
+/**
+ * @file        ts_journaled_ptr.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the pointer with the mutation journal.
+ * @date        10/18/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+
+#include <atomic>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <istream>
+#include <mutex>
+#include <ostream>
+#include <shared_mutex>
+#include <sstream>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "impl/ts_journal.h"
+#include "impl/ts_shared_ptr.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace ts {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief           Checks the given type is the serializable operation on T.
+ *
+ * @tparam TOp      The operation type.
+ * @tparam T        The object type.
+ */
+template <typename TOp, typename T>
+concept is_journal_operation = requires(const TOp& op, T& object, std::ostream& out
+        , std::istream& in)
+{
+    op.apply(object);
+    op.serialize(out);
+    { TOp::deserialize(in) } -> std::same_as<TOp>;
+};
+
+/**
+ * @brief       Checks the given type can be saved to the checkpoint.
+ *
+ * @tparam T    The object type.
+ */
+template <typename T>
+concept is_checkpointable = requires(const T& object, std::ostream& out, std::istream& in)
+{
+    object.serialize(out);
+    { T::deserialize(in) } -> std::same_as<T>;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief               ts::journaled_ptr is a thread-safe pointer which journals the mutations
+ *                      to the local log file and recovers the object on the construction.
+ *
+ * @details             The mutations are the serializable operations applied under the exclusive
+ *                      lock. The write path only serializes the operation to the memory, the
+ *                      background thread appends the accumulated batch to the journal file and
+ *                      syncs it once (group commit). Every checkpoint_interval operations the
+ *                      background thread saves the object to the checkpoint file and truncates
+ *                      the journal, so the recovery loads the checkpoint and replays only the
+ *                      tail of the journal. The operation is durable after flush().
+ * @example             struct counter
+ *                      {
+ *                          int m_value = 0;
+ *                          void serialize(std::ostream& out) const { out << m_value; }
+ *                          static counter deserialize(std::istream& in) { ... }
+ *                      };
+ *                      struct add
+ *                      {
+ *                          int m_delta = 0;
+ *                          void apply(counter& object) const { object.m_value += m_delta; }
+ *                          void serialize(std::ostream& out) const { out << m_delta; }
+ *                          static add deserialize(std::istream& in) { ... }
+ *                      };
+ *                      ts::journaled_ptr<counter, add> p_counter { "/var/lib/app/counter" };
+ *                      p_counter.apply(add { 13 });
+ *                      auto value = p_counter.read([](const counter& obj) { return obj.m_value; });
+ * @warning             The journal and checkpoint files are written in the native byte order,
+ *                      they are not portable between the machines.
+ * @tparam T            The type of the managed object.
+ * @tparam TOperation   The type of the serializable operation.
+ * @tparam TMutex       The type of mutex (optional by default std::shared_mutex).
+ */
+template <typename T, typename TOperation, typename TMutex = std::shared_mutex>
+requires(impl::is_journal_operation<TOperation, T> && impl::is_checkpointable<T>)
+class journaled_ptr
+{
+public:
+    using element_type = T;
+    using operation_type = TOperation;
+    using mutex_type = TMutex;
+
+    /**
+     * The journaling options.
+     */
+    struct journal_options
+    {
+        /**
+         * The count of the operations between the checkpoints.
+         */
+        std::size_t m_checkpoint_interval = 10000;
+    };
+
+public:
+    /**
+     * @brief           Recovers the object from the checkpoint and the journal at the given path.
+     *                  If there is no checkpoint, the object is constructed from the arguments.
+     *
+     * @param path      The path of the journal, the checkpoint is saved to path.checkpoint.
+     * @param args      List of arguments with which an instance of T will be constructed.
+     * @throws          ts::journal_exception if the files can't be opened or the checkpoint is
+     *                  corrupted.
+     */
+    template <typename... TArgs>
+    explicit journaled_ptr(std::filesystem::path path, TArgs&&... args)
+            requires(std::is_constructible_v<T, TArgs&&...>)
+        : journaled_ptr(journal_options {}, std::move(path), std::forward<TArgs>(args)...)
+    {
+    }
+
+    /**
+     * @brief           Recovers the object with the given journaling options.
+     *
+     * @param options   The journaling options.
+     * @param path      The path of the journal, the checkpoint is saved to path.checkpoint.
+     * @param args      List of arguments with which an instance of T will be constructed.
+     */
+    template <typename... TArgs>
+    journaled_ptr(journal_options options, std::filesystem::path path, TArgs&&... args)
+            requires(std::is_constructible_v<T, TArgs&&...>)
+        : m_options(options)
+        , m_checkpoint_path(checkpoint_path_of(path))
+        , m_ptr(recover(path, m_checkpoint_path, m_last_lsn, std::forward<TArgs>(args)...))
+        , m_view(m_ptr)
+        , m_journal(path)
+        , m_durable_lsn(m_last_lsn.load())
+        , m_writer([this]() { write_loop(); })
+    {
+    }
+
+    /**
+     * Prevent copying and moving of an object.
+     */
+    journaled_ptr(const journaled_ptr&) = delete;
+    journaled_ptr(journaled_ptr&&) = delete;
+    journaled_ptr& operator=(const journaled_ptr&) = delete;
+    journaled_ptr& operator=(journaled_ptr&&) = delete;
+
+    /**
+     * @brief   Writes the remaining operations to the journal and stops the background thread.
+     */
+    ~journaled_ptr()
+    {
+        {
+            std::lock_guard lock { m_pending_mtx };
+            m_is_stopped = true;
+        }
+        m_pending_cv.notify_one();
+        m_writer.join();
+    }
+
+public:
+    /**
+     * @brief       Applies the operation under the exclusive lock and queues it to the journal.
+     *
+     * @param op    The operation.
+     * @return      The log sequence number of the operation.
+     */
+    std::uint64_t apply(const operation_type& op)
+    {
+        std::ostringstream out;
+        op.serialize(out);
+        std::uint64_t lsn = 0;
+        {
+            auto object = m_ptr.acquire();
+            op.apply(*object);
+            lsn = m_last_lsn.load(std::memory_order_relaxed) + 1;
+            m_last_lsn.store(lsn, std::memory_order_relaxed);
+            std::lock_guard lock { m_pending_mtx };
+            m_pending.push_back(impl::journal_record { lsn, std::move(out).str() });
+        }
+        m_pending_cv.notify_one();
+        return lsn;
+    }
+
+    /**
+     * @brief           Invokes the function with the const reference to the object under the
+     *                  read lock.
+     *
+     * @tparam TFunc    The function type, invocable with const T&.
+     * @param func      The function object.
+     * @return          The result of the function.
+     */
+    template <typename TFunc>
+    decltype(auto) read(TFunc&& func) const
+    {
+        auto object = m_view.acquire();
+        return std::invoke(std::forward<TFunc>(func), *object);
+    }
+
+    /**
+     * @brief   Blocks until all applied operations are written to the journal file.
+     *
+     * @throws  ts::journal_exception if the background thread failed to write the journal.
+     */
+    void flush()
+    {
+        const std::uint64_t lsn = m_last_lsn.load(std::memory_order_acquire);
+        std::unique_lock lock { m_pending_mtx };
+        m_durable_cv.wait(lock, [this, lsn]()
+        {
+            return m_durable_lsn >= lsn || nullptr != m_error;
+        });
+        rethrow_error();
+    }
+
+    /**
+     * @brief   Saves the checkpoint and truncates the journal, blocks until it's done.
+     *
+     * @throws  ts::journal_exception if the background thread failed to write the checkpoint.
+     */
+    void checkpoint()
+    {
+        std::unique_lock lock { m_pending_mtx };
+        const std::size_t checkpoint_count = m_checkpoint_count + 1;
+        m_is_checkpoint_requested = true;
+        m_pending_cv.notify_one();
+        m_durable_cv.wait(lock, [this, checkpoint_count]()
+        {
+            return m_checkpoint_count >= checkpoint_count || nullptr != m_error;
+        });
+        rethrow_error();
+    }
+
+    /**
+     * @brief   Gets the log sequence number of the last operation written to the journal.
+     */
+    [[nodiscard]] std::uint64_t durable_lsn() const
+    {
+        std::lock_guard lock { m_pending_mtx };
+        return m_durable_lsn;
+    }
+
+private:
+    static std::filesystem::path checkpoint_path_of(const std::filesystem::path& path)
+    {
+        auto checkpoint_path = path;
+        checkpoint_path += ".checkpoint";
+        return checkpoint_path;
+    }
+
+    /**
+     * @internal
+     * @brief   Loads the checkpoint and replays the journal records after it.
+     */
+    template <typename... TArgs>
+    static ts::shared_ptr<T, TMutex> recover(const std::filesystem::path& path
+            , const std::filesystem::path& checkpoint_path, std::atomic<std::uint64_t>& last_lsn
+            , TArgs&&... args)
+    {
+        std::uint64_t lsn = 0;
+        ts::shared_ptr<T, TMutex> p_object;
+        if (auto record = impl::read_checkpoint(checkpoint_path))
+        {
+            std::istringstream in { std::move(record->m_payload) };
+            p_object = ts::shared_ptr<T, TMutex> { new T(T::deserialize(in)) };
+            lsn = record->m_lsn;
+        }
+        else if (std::error_code error; std::filesystem::exists(checkpoint_path, error))
+        {
+            impl::raise_journal_error("The checkpoint file " + checkpoint_path.string()
+                    + " is corrupted.");
+        }
+        else
+        {
+            p_object = ts::shared_ptr<T, TMutex> { new T(std::forward<TArgs>(args)...) };
+        }
+
+        T& object = *(p_object.get());
+        impl::journal_file::replay(path, [&object, &lsn](const impl::journal_record& record)
+        {
+            if (record.m_lsn > lsn)
+            {
+                std::istringstream in { record.m_payload };
+                TOperation::deserialize(in).apply(object);
+                lsn = record.m_lsn;
+            }
+        });
+        last_lsn.store(lsn);
+        return p_object;
+    }
+
+    /**
+     * @internal
+     * @brief   The loop of the background thread, writes the batches and the checkpoints.
+     */
+    void write_loop()
+    {
+        std::size_t operation_count = 0;
+        while (true)
+        {
+            std::vector<impl::journal_record> batch;
+            bool is_checkpoint_requested = false;
+            bool is_stopped = false;
+            {
+                std::unique_lock lock { m_pending_mtx };
+                m_pending_cv.wait(lock, [this]()
+                {
+                    return m_is_stopped || m_is_checkpoint_requested || !m_pending.empty();
+                });
+                batch.swap(m_pending);
+                is_checkpoint_requested = std::exchange(m_is_checkpoint_requested, false);
+                is_stopped = m_is_stopped;
+            }
+
+            try
+            {
+                if (!batch.empty())
+                {
+                    m_journal.append(batch);
+                    operation_count += batch.size();
+                    std::lock_guard lock { m_pending_mtx };
+                    m_durable_lsn = batch.back().m_lsn;
+                }
+                if (is_checkpoint_requested || operation_count >= m_options.m_checkpoint_interval)
+                {
+                    write_checkpoint();
+                    operation_count = 0;
+                    std::lock_guard lock { m_pending_mtx };
+                    ++m_checkpoint_count;
+                }
+            }
+            catch (...)
+            {
+                std::lock_guard lock { m_pending_mtx };
+                m_error = std::current_exception();
+                is_stopped = true;
+            }
+            m_durable_cv.notify_all();
+
+            if (is_stopped)
+            {
+                std::lock_guard lock { m_pending_mtx };
+                if (m_pending.empty() || nullptr != m_error)
+                {
+                    return;
+                }
+            }
+        }
+    }
+
+    /**
+     * @internal
+     * @brief   Saves the object with the last applied lsn and truncates the journal. All
+     *          records of the journal are covered by the checkpoint, the records applied after
+     *          the previous batch are still pending and are written after the truncation.
+     */
+    void write_checkpoint()
+    {
+        std::ostringstream out;
+        std::uint64_t lsn = 0;
+        {
+            auto object = m_view.acquire();
+            lsn = m_last_lsn.load(std::memory_order_relaxed);
+            object->serialize(out);
+        }
+        impl::write_checkpoint(m_checkpoint_path, lsn, std::move(out).str());
+        m_journal.truncate();
+    }
+
+    void rethrow_error() const
+    {
+        if (nullptr != m_error)
+        {
+            std::rethrow_exception(m_error);
+        }
+    }
+
+private:
+    journal_options m_options;
+    std::filesystem::path m_checkpoint_path;
+    std::atomic<std::uint64_t> m_last_lsn { 0 };
+    ts::shared_ptr<T, TMutex> m_ptr;
+    ts::shared_ptr<const T, TMutex> m_view;
+    impl::journal_file m_journal;
+
+    mutable std::mutex m_pending_mtx {};
+    std::condition_variable m_pending_cv {};
+    std::condition_variable m_durable_cv {};
+    std::vector<impl::journal_record> m_pending {};
+    std::uint64_t m_durable_lsn = 0;
+    std::size_t m_checkpoint_count = 0;
+    bool m_is_checkpoint_requested = false;
+    bool m_is_stopped = false;
+    std::exception_ptr m_error {};
+
+    std::thread m_writer;
+}; // class journaled_ptr
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace ts
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#endif // THREADSAFESMARTPOINTERS_TS_JOURNALED_PTR_H
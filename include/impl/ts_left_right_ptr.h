@@ -0,0 +1,207 @@
+#ifndef THREADSAFESMARTPOINTERS_TS_LEFT_RIGHT_PTR_H
+#define THREADSAFESMARTPOINTERS_TS_LEFT_RIGHT_PTR_H
+
+/**
+ * @file        ts_left_right_ptr.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of left-right concurrency control pointer.
+ * @date        10/18/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+#include "impl/ts_read_indicator.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace ts {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief           ts::left_right_ptr is a smart pointer which keeps two instances of the object
+ *                  and provides wait-free read access (Left-Right concurrency control).
+ *
+ * @details         The readers always read the active instance and never block. The writer
+ *                  applies the modification to the inactive instance, makes it active, waits
+ *                  until the readers leave the old instance and applies the same modification
+ *                  to it. The writers are serialized by the mutex and never allocate, unlike
+ *                  the copy-on-write, but the modification is applied twice, so it should be
+ *                  deterministic.
+ * @example         ts::left_right_ptr<std::map<int, int>> map_ptr;
+ *                  map_ptr.modify([](auto& map) { map[1] = 13; });
+ *                  auto size = map_ptr->size();
+ *                  auto val = map_ptr.read([](const auto& map) { return map.at(1); });
+ * @tparam T        The type of the managed object.
+ * @tparam TMutex   The type of mutex which serializes the writers (optional by default
+ *                  std::mutex).
+ */
+template <typename T, typename TMutex = std::mutex>
+class left_right_ptr
+{
+public:
+    using element_type = T;
+    using mutex_type = TMutex;
+
+private:
+    /**
+     * @internal
+     *
+     * @class   read_proxy
+     * @brief   The proxy object which registers the reader for the duration of its lifetime,
+     *          used by the operator-> (Execute Around Pointer Idiom).
+     */
+    class read_proxy
+    {
+    public:
+        explicit read_proxy(const left_right_ptr& owner) noexcept
+            : m_indicator(owner.arrive())
+            , m_ptr(&owner.active())
+        {
+        }
+
+        ~read_proxy()
+        {
+            m_indicator.depart();
+        }
+
+        read_proxy(const read_proxy&) = delete;
+        read_proxy(read_proxy&&) = delete;
+        read_proxy& operator=(const read_proxy&) = delete;
+        read_proxy& operator=(read_proxy&&) = delete;
+
+        const element_type* operator->() const noexcept
+        {
+            return m_ptr;
+        }
+
+    private:
+        impl::read_indicator& m_indicator;
+        const element_type* m_ptr;
+    };
+
+public:
+    /**
+     * @brief           Constructs both instances of the object from the given arguments.
+     *
+     * @tparam TArgs    The types of list of arguments with which an instance of T will be
+     *                  constructed.
+     * @param args      List of arguments with which an instance of T will be constructed.
+     */
+    template <typename... TArgs>
+    explicit left_right_ptr(TArgs&&... args) requires(std::is_constructible_v<T, TArgs&...>)
+        : m_instances { T(args...), T(args...) }
+    {
+    }
+
+    /**
+     * Prevent copying and moving of an object.
+     */
+    left_right_ptr(const left_right_ptr&) = delete;
+    left_right_ptr(left_right_ptr&&) = delete;
+    left_right_ptr& operator=(const left_right_ptr&) = delete;
+    left_right_ptr& operator=(left_right_ptr&&) = delete;
+
+    ~left_right_ptr() = default;
+
+public:
+    /**
+     * @brief           Invokes the function with the const reference to the active instance.
+     *                  The call is wait-free, it's never blocked by the writers.
+     *
+     * @tparam TFunc    The function type, invocable with const T&.
+     * @param func      The function object.
+     * @return          The result of the function.
+     */
+    template <typename TFunc>
+    decltype(auto) read(TFunc&& func) const
+    {
+        read_proxy proxy { *this };
+        return std::invoke(std::forward<TFunc>(func), *(proxy.operator->()));
+    }
+
+    /**
+     * @brief   Returns the read-only object until reached ";" (Execute Around Pointer Idiom).
+     *
+     * @example auto size = map_ptr->size();
+     * @return  The proxy object which provides the const pointer to the active instance.
+     */
+    read_proxy operator->() const noexcept
+    {
+        return read_proxy { *this };
+    }
+
+    /**
+     * @brief           Applies the modification to both instances. The function is invoked
+     *                  twice, first with the inactive instance, then with the previously active
+     *                  one after all its readers left, so it should produce the same changes.
+     *
+     * @tparam TFunc    The function type, invocable with T&.
+     * @param func      The function object.
+     */
+    template <typename TFunc>
+    void modify(TFunc&& func)
+    {
+        std::lock_guard lock { m_writer_mtx };
+        const std::size_t active = m_active.load(std::memory_order_relaxed);
+        const std::size_t inactive = active ^ 1;
+
+        std::invoke(func, m_instances[inactive]);
+        m_active.store(inactive, std::memory_order_seq_cst);
+        toggle_version_and_wait();
+        std::invoke(std::forward<TFunc>(func), m_instances[active]);
+    }
+
+private:
+    /**
+     * @internal
+     * @brief   Registers the reader in the indicator of the current version.
+     */
+    impl::read_indicator& arrive() const noexcept
+    {
+        impl::read_indicator& indicator
+                = m_indicators[m_version.load(std::memory_order_seq_cst)];
+        indicator.arrive();
+        return indicator;
+    }
+
+    const element_type& active() const noexcept
+    {
+        return m_instances[m_active.load(std::memory_order_seq_cst)];
+    }
+
+    /**
+     * @internal
+     * @brief   Switches the new readers to the other indicator and waits until the readers of
+     *          both indicators, which could see the previously active instance, leave.
+     */
+    void toggle_version_and_wait()
+    {
+        const std::size_t previous = m_version.load(std::memory_order_relaxed);
+        const std::size_t next = previous ^ 1;
+        m_indicators[next].wait_empty();
+        m_version.store(next, std::memory_order_seq_cst);
+        m_indicators[previous].wait_empty();
+    }
+
+private:
+    std::array<element_type, 2> m_instances;
+    mutable std::array<impl::read_indicator, 2> m_indicators {};
+
+    alignas(impl::config::s_cache_line_size) std::atomic<std::size_t> m_active { 0 };
+    std::atomic<std::size_t> m_version { 0 };
+    TMutex m_writer_mtx {};
+}; // class left_right_ptr
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace ts
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#endif // THREADSAFESMARTPOINTERS_TS_LEFT_RIGHT_PTR_H
@@ -0,0 +1,349 @@
+#ifndef THREADSAFESMARTPOINTERS_TS_LOCK_ANY_H
+#define THREADSAFESMARTPOINTERS_TS_LOCK_ANY_H
+
+/**
+ * @file        ts_lock_any.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the waiting for any of several lockables.
+ * @date        10/18/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+#include "impl/ts_config.h"
+#include "impl/ts_mutex.h"
+#include "impl/ts_random.h"
+#include "impl/ts_thread_annotations.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace ts {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @internal
+ *
+ * @class       unlock_event
+ * @brief       The process-wide eventcount of the unlocks of ts::notifying_mutex.
+ *
+ * @details     The waiter announces itself, reads the epoch, retries the lockables and waits
+ *              until the epoch changes. The unlocker bumps the epoch and wakes the waiters only
+ *              if there are announced waiters, otherwise the unlock costs the fence and the
+ *              relaxed load. The fences of both sides guarantee that either the unlocker sees
+ *              the waiter, or the retry of the waiter sees the unlocked mutex.
+ */
+class unlock_event
+{
+public:
+    static unlock_event& instance()
+    {
+        static unlock_event s_event {};
+        return s_event;
+    }
+
+    /**
+     * @brief   Announces the waiter, the lockables should be retried after it.
+     *
+     * @return  The key for wait().
+     */
+    std::uint32_t prepare_wait() noexcept
+    {
+        m_waiters.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        return m_epoch.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief   Withdraws the announcement if the retry succeeded.
+     */
+    void cancel_wait() noexcept
+    {
+        m_waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief   Blocks until any unlock after prepare_wait(), withdraws the announcement.
+     */
+    void wait(std::uint32_t key) noexcept
+    {
+        m_epoch.wait(key, std::memory_order_acquire);
+        m_waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief   Wakes the waiters, called after the unlock.
+     */
+    void notify() noexcept
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (0 != m_waiters.load(std::memory_order_relaxed))
+        {
+            m_epoch.fetch_add(1, std::memory_order_release);
+            m_epoch.notify_all();
+        }
+    }
+
+private:
+    unlock_event() = default;
+
+private:
+    alignas(config::s_cache_line_size) std::atomic<std::uint32_t> m_epoch { 0 };
+    alignas(config::s_cache_line_size) std::atomic<std::uint32_t> m_waiters { 0 };
+}; // class unlock_event
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief           ts::notifying_mutex is a mutex adapter which wakes the threads blocked in
+ *                  ts::lock_any on every unlock. Without the blocked threads the unlock costs
+ *                  the fence and the relaxed load.
+ *
+ * @example         using t_shard_ptr = ts::shared_ptr<shard, ts::notifying_mutex<>>;
+ *                  std::array<t_shard_ptr, 4> shards { ... };
+ *                  const std::size_t index = ts::lock_any(std::span { shards });
+ *                  std::unique_lock lock { shards[index], std::adopt_lock };
+ * @tparam TMutex   The underlying mutex type (optional by default std::mutex).
+ */
+template <typename TMutex = std::mutex>
+class notifying_mutex
+{
+public:
+    using mutex_type = TMutex;
+
+public:
+    notifying_mutex() = default;
+    ~notifying_mutex() = default;
+
+    /**
+     * Prevent copying and moving of an object.
+     */
+    notifying_mutex(const notifying_mutex&) = delete;
+    notifying_mutex(notifying_mutex&&) = delete;
+    notifying_mutex& operator=(const notifying_mutex&) = delete;
+    notifying_mutex& operator=(notifying_mutex&&) = delete;
+
+public:
+    /**
+     * @brief   Locks the mutex, blocks if the mutex is not available.
+     */
+    void lock()
+    {
+        m_mtx.lock();
+    }
+
+    /**
+     * @brief   Tries to lock the mutex.
+     *
+     * @return  true if the lock was acquired successfully, otherwise false.
+     */
+    bool try_lock()
+    {
+        return m_mtx.try_lock();
+    }
+
+    /**
+     * @brief   Unlocks the mutex and wakes the threads blocked in ts::lock_any.
+     */
+    void unlock()
+    {
+        m_mtx.unlock();
+        impl::unlock_event::instance().notify();
+    }
+
+    /**
+     * @brief   Locks the mutex for shared ownership, blocks if the mutex is not available.
+     */
+    void lock_shared() requires(impl::is_shared_lockable<TMutex>)
+    {
+        m_mtx.lock_shared();
+    }
+
+    /**
+     * @brief   Tries to lock the mutex for shared ownership.
+     *
+     * @return  true if the lock was acquired successfully, otherwise false.
+     */
+    bool try_lock_shared() requires(impl::is_shared_lockable<TMutex>)
+    {
+        return m_mtx.try_lock_shared();
+    }
+
+    /**
+     * @brief   Unlocks the mutex (shared ownership) and wakes the threads blocked in
+     *          ts::lock_any.
+     */
+    void unlock_shared() requires(impl::is_shared_lockable<TMutex>)
+    {
+        m_mtx.unlock_shared();
+        impl::unlock_event::instance().notify();
+    }
+
+    /**
+     * @brief   Gets the position of the underlying ranked mutex in the lock hierarchy.
+     */
+    friend impl::lock_order_key lock_order_key_of(const notifying_mutex& mtx) noexcept
+            requires(impl::is_ranked_lockable<TMutex>)
+    {
+        return lock_order_key_of(mtx.m_mtx);
+    }
+
+private:
+    TMutex m_mtx {};
+}; // class notifying_mutex
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+struct is_notifying_mutex : std::false_type
+{
+};
+
+template <typename T>
+struct is_notifying_mutex<notifying_mutex<T>> : std::true_type
+{
+};
+
+template <typename T>
+struct is_notifying_mutex<instrumented_mutex<T>> : is_notifying_mutex<T>
+{
+};
+
+/**
+ * @brief       Checks the unlocks of the given lockable wake ts::lock_any: ts::notifying_mutex
+ *              or ts::shared_ptr and ts::unique_ptr with ts::notifying_mutex.
+ *
+ * @tparam T    The lockable type.
+ */
+template <typename T>
+concept is_notifying_lockable = is_notifying_mutex<std::remove_cv_t<T>>::value
+        || is_notifying_mutex<typename std::remove_cv_t<T>::mutex_type>::value;
+
+/**
+ * @internal
+ * @brief           Tries to lock the lockables once, starting from the given index.
+ *
+ * @return          The index of the acquired lockable, or std::nullopt.
+ */
+template <typename TTryLock>
+std::optional<std::size_t> try_lock_any(std::size_t count, std::size_t first, TTryLock&& try_lock)
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const std::size_t index = (first + i) % count;
+        if (try_lock(index))
+        {
+            return index;
+        }
+    }
+    return std::nullopt;
+}
+
+/**
+ * @internal
+ * @brief           Blocks until one of the lockables is acquired. The tries start from the
+ *                  random lockable, so the first lockables are not preferred by all threads.
+ *
+ * @throws          std::invalid_argument if there are no lockables.
+ * @return          The index of the acquired lockable.
+ */
+template <typename TTryLock>
+std::size_t lock_any(std::size_t count, TTryLock&& try_lock)
+{
+    if (0 == count)
+    {
+        if constexpr (config::s_enable_exceptions)
+        {
+            throw std::invalid_argument { "ts::lock_any requires at least one lockable." };
+        }
+        else
+        {
+            std::terminate();
+        }
+    }
+    const std::size_t first = thread_local_random(count);
+    unlock_event& event = unlock_event::instance();
+    while (true)
+    {
+        if (const auto index = try_lock_any(count, first, try_lock))
+        {
+            return *index;
+        }
+        const std::uint32_t key = event.prepare_wait();
+        if (const auto index = try_lock_any(count, first, try_lock))
+        {
+            event.cancel_wait();
+            return *index;
+        }
+        event.wait(key);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief               Blocks until any of the lockables is acquired, without polling: the
+ *                      thread sleeps until one of the lockables is unlocked. The acquired
+ *                      lockable should be unlocked by the caller.
+ *
+ * @example             const std::size_t index = ts::lock_any(p_shard_a, p_shard_b);
+ * @tparam TLockables   The types of ts::shared_ptr and ts::unique_ptr with ts::notifying_mutex,
+ *                      or ts::notifying_mutex.
+ * @param lockables     The lockables.
+ * @return              The index of the acquired lockable.
+ */
+template <typename... TLockables>
+std::size_t lock_any(TLockables&... lockables)
+        requires(0 != sizeof...(TLockables) && (impl::is_notifying_lockable<TLockables> && ...))
+{
+    return impl::lock_any(sizeof...(TLockables), [&lockables...](std::size_t index)
+            TS_NO_THREAD_SAFETY_ANALYSIS
+    {
+        std::size_t current = 0;
+        return ((index == current++ && lockables.try_lock()) || ...);
+    });
+}
+
+/**
+ * @brief               Blocks until any of the lockables in the span is acquired, see the
+ *                      variadic overload.
+ *
+ * @throws              std::invalid_argument if the span is empty.
+ * @param lockables     The lockables.
+ * @return              The index of the acquired lockable.
+ */
+template <typename TLockable, std::size_t Extent>
+std::size_t lock_any(std::span<TLockable, Extent> lockables)
+        requires(impl::is_notifying_lockable<TLockable>)
+{
+    return impl::lock_any(lockables.size(), [lockables](std::size_t index)
+            TS_NO_THREAD_SAFETY_ANALYSIS
+    {
+        return lockables[index].try_lock();
+    });
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace ts
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#endif // THREADSAFESMARTPOINTERS_TS_LOCK_ANY_H
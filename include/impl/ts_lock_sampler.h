@@ -0,0 +1,119 @@
+#ifndef THREADSAFESMARTPOINTERS_TS_LOCK_SAMPLER_H
+#define THREADSAFESMARTPOINTERS_TS_LOCK_SAMPLER_H
+
+/**
+ * @file        ts_lock_sampler.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the sampled lock profiler.
+ * @date        10/18/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "impl/ts_instrumentation.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace ts {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   The sampled profile of the instrumented mutex, the estimates are the sampled values
+ *          scaled by the sampling period.
+ */
+struct lock_profile_entry
+{
+    /**
+     * The id of the mutex, the same as in ts::lock_trace.
+     */
+    std::uint64_t m_mutex_id = 0;
+
+    std::uint64_t m_sample_count = 0;
+    std::uint64_t m_estimated_acquisitions = 0;
+    std::chrono::nanoseconds m_estimated_wait { 0 };
+    std::chrono::nanoseconds m_estimated_hold { 0 };
+};
+
+/**
+ * @brief   ts::lock_sampler times the 1-in-N acquisitions of all instrumented mutexes from the
+ *          construction until the destruction, cheap enough to be left on in production.
+ *          The acquisitions which are not sampled cost the thread-local countdown. Only one
+ *          sampler should be alive at a time.
+ *
+ * @details The ts::shared_ptr and ts::unique_ptr mutexes are instrumented if
+ *          THREADSAFESMARTPOINTERS_INSTRUMENT_LOCKS is defined, so the acquisitions by the
+ *          structure dereference and subscript operators and by lock() are sampled.
+ * @example ts::lock_sampler sampler { 1000 };
+ *          // serve the requests
+ *          for (const auto& entry : sampler.collect())
+ *          {
+ *              report(entry.m_mutex_id, entry.m_estimated_wait);
+ *          }
+ */
+class lock_sampler
+{
+public:
+    /**
+     * @brief           Starts the sampling, the previous samples are dropped.
+     *
+     * @param period    The mean count of the acquisitions per sample, 1 samples all of them.
+     */
+    explicit lock_sampler(std::uint32_t period = 1000)
+    {
+        impl::lock_sampling_sink::instance().start(period);
+    }
+
+    ~lock_sampler()
+    {
+        impl::lock_sampling_sink::instance().stop();
+    }
+
+    /**
+     * Prevent copying and moving of an object.
+     */
+    lock_sampler(const lock_sampler&) = delete;
+    lock_sampler(lock_sampler&&) = delete;
+    lock_sampler& operator=(const lock_sampler&) = delete;
+    lock_sampler& operator=(lock_sampler&&) = delete;
+
+    [[nodiscard]] std::uint32_t period() const noexcept
+    {
+        return impl::lock_sampling_sink::instance().period();
+    }
+
+    /**
+     * @brief   Gets the profile of the sampled mutexes, ordered by the estimated wait from the
+     *          most waited. The sampling continues.
+     */
+    [[nodiscard]] std::vector<lock_profile_entry> collect() const
+    {
+        const std::uint64_t scale = period();
+        std::vector<lock_profile_entry> profile;
+        for (const auto& [mutex_id, samples] : impl::lock_sampling_sink::instance().collect())
+        {
+            profile.push_back(lock_profile_entry {
+                    mutex_id
+                    , samples.m_sample_count
+                    , samples.m_sample_count * scale
+                    , std::chrono::nanoseconds { static_cast<std::chrono::nanoseconds::rep>(
+                            samples.m_wait_ns * scale) }
+                    , std::chrono::nanoseconds { static_cast<std::chrono::nanoseconds::rep>(
+                            samples.m_hold_ns * scale) } });
+        }
+        std::ranges::stable_sort(profile, std::ranges::greater {}
+                , &lock_profile_entry::m_estimated_wait);
+        return profile;
+    }
+}; // class lock_sampler
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace ts
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#endif // THREADSAFESMARTPOINTERS_TS_LOCK_SAMPLER_H
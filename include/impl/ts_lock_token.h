@@ -0,0 +1,197 @@
+#ifndef THREADSAFESMARTPOINTERS_TS_LOCK_TOKEN_H
+#define THREADSAFESMARTPOINTERS_TS_LOCK_TOKEN_H
+
+/**
+ * @file        ts_lock_token.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the lock token of thread-safe smart pointers.
+ * @date        10/18/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+
+#include <cstddef>
+#include <mutex>
+#include <shared_mutex>
+#include <type_traits>
+#include <utility>
+
+#include "impl/ts_mutex.h"
+#include "impl/ts_thread_annotations.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace ts {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief           ts::lock_token is the capability which proves the ts::shared_ptr or
+ *                  ts::unique_ptr is locked by the current thread, it owns the lock during its
+ *                  lifetime.
+ *
+ * @details         The token is returned by acquire() and gives the access to the object without
+ *                  any additional locking. The helper functions accept the token by reference
+ *                  instead of the pointer, so they can't be called without the lock and they
+ *                  don't lock again. The token of the read-only ts::shared_ptr<const T> with the
+ *                  shared mutex owns the shared lock. Constructed directly in the scope
+ *                  (ts::lock_token token { ptr };) the token is also checked by the Clang thread
+ *                  safety analysis, the token of the read-only pointer is the shared capability.
+ *                  The helpers annotated with TS_REQUIRES(ptr) or TS_REQUIRES_SHARED(ptr) can't be
+ *                  called without it.
+ * @example         void push_if_empty(ts::lock_token<t_queue_ptr>& queue, int value)
+ *                  {
+ *                      if (queue->empty())
+ *                      {
+ *                          queue->push(value);
+ *                      }
+ *                  }
+ *                  auto token = queue_ptr.acquire();
+ *                  push_if_empty(token, 13);
+ * @warning         The reference to the object should not outlive the token.
+ * @tparam TOwner   The type of ts::shared_ptr or ts::unique_ptr.
+ */
+template <typename TOwner>
+class TS_SCOPED_CAPABILITY lock_token
+{
+    using t_pointer = decltype(std::declval<const TOwner&>().get());
+
+public:
+    using owner_type = TOwner;
+    using element_type = std::remove_pointer_t<t_pointer>;
+
+    /**
+     * The lock of the token, shared for the read-only objects if the mutex supports it, doesn't
+     * lock again the ts::owner_aware_mutex held by the current thread.
+     */
+    using lock_type = std::conditional_t<std::is_const_v<element_type>
+            , impl::t_read_lock<const TOwner>
+            , impl::t_write_lock<const TOwner>>;
+
+public:
+    /**
+     * @brief       Locks the owner and constructs the token.
+     *
+     * @param owner The ts::shared_ptr or ts::unique_ptr to lock.
+     */
+    template <typename TElement = element_type>
+            requires(!std::is_const_v<TElement>)
+    explicit lock_token(const TOwner& owner) TS_ACQUIRE(owner) TS_NO_THREAD_SAFETY_ANALYSIS
+        : m_lock(owner)
+        , m_ptr(owner.get())
+    {
+    }
+
+    /**
+     * @brief       Locks the read-only owner and constructs the token, the lock is shared if the
+     *              mutex supports it.
+     *
+     * @param owner The read-only ts::shared_ptr to lock.
+     */
+    template <typename TElement = element_type>
+            requires(std::is_const_v<TElement>)
+    explicit lock_token(const TOwner& owner) TS_ACQUIRE_SHARED(owner)
+            TS_NO_THREAD_SAFETY_ANALYSIS
+        : m_lock(owner)
+        , m_ptr(owner.get())
+    {
+    }
+
+    ~lock_token() TS_RELEASE() TS_NO_THREAD_SAFETY_ANALYSIS
+    {
+    }
+
+    lock_token(lock_token&&) noexcept = default;
+
+    /**
+     * Prevent copying of an object.
+     */
+    lock_token(const lock_token&) = delete;
+    lock_token& operator=(const lock_token&) = delete;
+    lock_token& operator=(lock_token&&) = delete;
+
+public:
+    /**
+     * @brief   Gets the reference to the object, without locking.
+     *
+     * @return  The reference to the object.
+     */
+    element_type& operator*() const noexcept
+    {
+        return *m_ptr;
+    }
+
+    /**
+     * @brief   Gets the pointer to the object, without locking.
+     *
+     * @return  The pointer to the object.
+     */
+    element_type* operator->() const noexcept
+    {
+        return m_ptr;
+    }
+
+    /**
+     * @brief       Gets the array element, without locking.
+     *
+     * @param index The index of the element.
+     * @return      The reference to the element.
+     */
+    element_type& operator[](std::size_t index) const noexcept
+    {
+        return m_ptr[index];
+    }
+
+    /**
+     * @brief   Gets the raw pointer to the object.
+     *
+     * @return  The raw pointer.
+     */
+    [[nodiscard]] element_type* get() const noexcept
+    {
+        return m_ptr;
+    }
+
+    /**
+     * @brief   Releases the lock only if other threads wait for it, lets one of them through and
+     *          reacquires the lock, available if the mutex is ts::contention_aware_mutex.
+     *          Without the waiters it is a single relaxed load. The object can be changed
+     *          during the yield, the previously taken references should be revalidated.
+     *
+     * @example auto storage = p_storage.acquire();
+     *          for (auto& segment : storage->segments())
+     *          {
+     *              segment.compact();
+     *              storage.yield_if_contended();
+     *          }
+     * @return  true if the lock was released and reacquired, otherwise false.
+     */
+    bool yield_if_contended() requires(impl::is_contention_aware_lockable<const TOwner>)
+    {
+        if (!impl::yield_if_contended(m_lock, owner()))
+        {
+            return false;
+        }
+        m_ptr = owner().get();
+        return true;
+    }
+
+    /**
+     * @brief   Gets the locked ts::shared_ptr or ts::unique_ptr.
+     *
+     * @return  The owner of the object.
+     */
+    [[nodiscard]] const owner_type& owner() const noexcept
+    {
+        return *(m_lock.mutex());
+    }
+
+private:
+    lock_type m_lock;
+    element_type* m_ptr;
+}; // class lock_token
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace ts
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#endif // THREADSAFESMARTPOINTERS_TS_LOCK_TOKEN_H
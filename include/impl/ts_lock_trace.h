@@ -0,0 +1,352 @@
+#ifndef THREADSAFESMARTPOINTERS_TS_LOCK_TRACE_H
+#define THREADSAFESMARTPOINTERS_TS_LOCK_TRACE_H
+
+/**
+ * @file        ts_lock_trace.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the lock trace recorder and replayer.
+ * @date        10/18/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "impl/ts_instrumentation.h"
+#include "impl/ts_mutex.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace ts {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   ts::lock_trace is the recorded sequence of the lock acquisitions of the
+ *          instrumented mutexes: timestamp, thread, mutex id, access mode, wait and hold
+ *          durations, ordered by the timestamp.
+ */
+class lock_trace
+{
+public:
+    using event_type = impl::lock_event;
+
+public:
+    lock_trace() = default;
+
+    explicit lock_trace(std::vector<event_type> events) noexcept
+        : m_events(std::move(events))
+    {
+    }
+
+    [[nodiscard]] const std::vector<event_type>& events() const noexcept
+    {
+        return m_events;
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return m_events.size();
+    }
+
+    /**
+     * @brief   Saves the trace in the compact binary format (the native byte order).
+     */
+    void save(std::ostream& out) const
+    {
+        const std::uint64_t count = m_events.size();
+        out.write(s_magic.data(), static_cast<std::streamsize>(s_magic.size()));
+        out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+        out.write(reinterpret_cast<const char*>(m_events.data())
+                , static_cast<std::streamsize>(m_events.size() * sizeof(event_type)));
+    }
+
+    /**
+     * @brief   Loads the trace saved by save().
+     *
+     * @return  The trace, or std::nullopt if the stream doesn't contain the valid trace.
+     */
+    static std::optional<lock_trace> load(std::istream& in)
+    {
+        std::array<char, 8> magic {};
+        std::uint64_t count = 0;
+        in.read(magic.data(), static_cast<std::streamsize>(magic.size()));
+        in.read(reinterpret_cast<char*>(&count), sizeof(count));
+        if (!in || magic != s_magic || count > (std::uint64_t { 1 } << 32))
+        {
+            return std::nullopt;
+        }
+        // The count is not trusted, the events are read in chunks, so the truncated stream
+        // fails before the memory for the whole count is allocated.
+        std::vector<event_type> events;
+        while (events.size() < count)
+        {
+            const std::size_t offset = events.size();
+            const std::size_t chunk = static_cast<std::size_t>(std::min<std::uint64_t>(
+                    count - offset, s_load_chunk_size));
+            events.resize(offset + chunk);
+            in.read(reinterpret_cast<char*>(events.data() + offset)
+                    , static_cast<std::streamsize>(chunk * sizeof(event_type)));
+            if (!in)
+            {
+                return std::nullopt;
+            }
+        }
+        return lock_trace { std::move(events) };
+    }
+
+private:
+    static constexpr std::array<char, 8> s_magic { 'T', 'S', 'L', 'O', 'C', 'K', '0', '1' };
+    static constexpr std::size_t s_load_chunk_size = 4096;
+
+private:
+    std::vector<event_type> m_events {};
+}; // class lock_trace
+
+/**
+ * @brief   ts::lock_trace_recorder records the acquisitions of all instrumented mutexes to the
+ *          per-thread buffers from the construction until stop().
+ *
+ * @example ts::lock_trace_recorder recorder;
+ *          run_workload();
+ *          std::ofstream file { "workload.trace", std::ios::binary };
+ *          recorder.stop().save(file);
+ * @warning Only one recorder should be active at the same time.
+ */
+class lock_trace_recorder
+{
+public:
+    lock_trace_recorder()
+    {
+        impl::lock_trace_sink::instance().start();
+    }
+
+    ~lock_trace_recorder()
+    {
+        if (m_is_recording)
+        {
+            (void) impl::lock_trace_sink::instance().stop();
+        }
+    }
+
+    /**
+     * Prevent copying and moving of an object.
+     */
+    lock_trace_recorder(const lock_trace_recorder&) = delete;
+    lock_trace_recorder(lock_trace_recorder&&) = delete;
+    lock_trace_recorder& operator=(const lock_trace_recorder&) = delete;
+    lock_trace_recorder& operator=(lock_trace_recorder&&) = delete;
+
+    /**
+     * @brief   Stops the recording and collects the events of all threads.
+     *
+     * @return  The recorded trace.
+     */
+    lock_trace stop()
+    {
+        m_is_recording = false;
+        return lock_trace { impl::lock_trace_sink::instance().stop() };
+    }
+
+private:
+    bool m_is_recording = true;
+}; // class lock_trace_recorder
+
+/**
+ * @brief   The options of the trace replay.
+ */
+struct replay_options
+{
+    /**
+     * The scale of the recorded think and hold durations, e.g. 0.5 replays twice faster.
+     */
+    double m_time_scale = 1.0;
+};
+
+/**
+ * @brief   The result of the trace replay against the mutex type.
+ */
+struct replay_report
+{
+    std::size_t m_acquisition_count = 0;
+    std::chrono::nanoseconds m_elapsed {};
+
+    /**
+     * The acquisitions per second.
+     */
+    double m_throughput = 0.0;
+
+    std::chrono::nanoseconds m_median_wait {};
+    std::chrono::nanoseconds m_p99_wait {};
+    std::chrono::nanoseconds m_max_wait {};
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline void spin_for(std::uint64_t duration_ns) noexcept
+{
+    const std::uint64_t deadline = now_ns() + duration_ns;
+    while (now_ns() < deadline)
+    {
+    }
+}
+
+inline std::uint64_t scale_ns(std::uint64_t duration_ns, double scale) noexcept
+{
+    return static_cast<std::uint64_t>(static_cast<double>(duration_ns) * scale);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief           Re-executes the trace against the mutex type: every recorded thread is
+ *                  replayed by its own thread, every recorded mutex by its own TMutex. The
+ *                  thread keeps the recorded think time between the acquisitions and holds the
+ *                  lock for the recorded duration, the shared acquisitions lock the shared
+ *                  mutex for shared ownership.
+ *
+ * @example         auto trace = ts::lock_trace::load(file).value();
+ *                  auto mutex_report = ts::replay_trace<std::mutex>(trace);
+ *                  auto shared_mutex_report = ts::replay_trace<std::shared_mutex>(trace);
+ * @tparam TMutex   The mutex type.
+ * @param trace     The recorded trace.
+ * @param options   The replay options.
+ * @return          The throughput and the wait latency of the replay.
+ */
+template <typename TMutex>
+replay_report replay_trace(const lock_trace& trace, replay_options options = {})
+{
+    replay_report report {};
+    if (0 == trace.size())
+    {
+        return report;
+    }
+
+    std::map<std::uint32_t, std::vector<const impl::lock_event*>> thread_events;
+    std::unordered_map<std::uint64_t, std::unique_ptr<TMutex>> mutexes;
+    for (const auto& event : trace.events())
+    {
+        thread_events[event.m_thread].push_back(&event);
+        auto& p_mutex = mutexes[event.m_mutex_id];
+        if (nullptr == p_mutex)
+        {
+            p_mutex = std::make_unique<TMutex>();
+        }
+    }
+
+    const std::uint64_t trace_start = trace.events().front().m_timestamp_ns;
+    std::vector<std::vector<std::uint64_t>> waits(thread_events.size());
+    std::atomic_bool is_started { false };
+    std::vector<std::thread> arr_threads;
+    std::size_t thread_index = 0;
+    for (const auto& [thread, events] : thread_events)
+    {
+        arr_threads.emplace_back([&, &events = events, &thread_waits = waits[thread_index]]()
+        {
+            while (!is_started.load(std::memory_order_acquire))
+            {
+                std::this_thread::yield();
+            }
+            std::uint64_t previous_end = trace_start;
+            thread_waits.reserve(events.size());
+            for (const impl::lock_event* p_event : events)
+            {
+                impl::spin_for(impl::scale_ns(p_event->m_timestamp_ns - std::min(previous_end
+                        , p_event->m_timestamp_ns), options.m_time_scale));
+                previous_end = p_event->m_timestamp_ns + p_event->m_wait_ns + p_event->m_hold_ns;
+
+                TMutex& mtx = *(mutexes.at(p_event->m_mutex_id));
+                const bool is_shared = (impl::access_mode::shared == p_event->m_mode);
+                const std::uint64_t request_ns = impl::now_ns();
+                if constexpr (impl::is_shared_lockable<TMutex>)
+                {
+                    is_shared ? mtx.lock_shared() : mtx.lock();
+                }
+                else
+                {
+                    mtx.lock();
+                }
+                thread_waits.push_back(impl::now_ns() - request_ns);
+                impl::spin_for(impl::scale_ns(p_event->m_hold_ns, options.m_time_scale));
+                if constexpr (impl::is_shared_lockable<TMutex>)
+                {
+                    is_shared ? mtx.unlock_shared() : mtx.unlock();
+                }
+                else
+                {
+                    mtx.unlock();
+                }
+            }
+        });
+        ++thread_index;
+    }
+
+    const std::uint64_t start_ns = impl::now_ns();
+    is_started.store(true, std::memory_order_release);
+    for (auto& thread : arr_threads)
+    {
+        thread.join();
+    }
+    const std::uint64_t elapsed_ns = std::max<std::uint64_t>(1, impl::now_ns() - start_ns);
+
+    std::vector<std::uint64_t> all_waits;
+    all_waits.reserve(trace.size());
+    for (const auto& thread_waits : waits)
+    {
+        all_waits.insert(all_waits.end(), thread_waits.begin(), thread_waits.end());
+    }
+    std::ranges::stable_sort(all_waits);
+
+    const auto percentile = [&all_waits](double fraction)
+    {
+        const auto index = static_cast<std::size_t>(fraction
+                * static_cast<double>(all_waits.size() - 1));
+        return std::chrono::nanoseconds { all_waits[index] };
+    };
+    report.m_acquisition_count = all_waits.size();
+    report.m_elapsed = std::chrono::nanoseconds { elapsed_ns };
+    report.m_throughput = static_cast<double>(all_waits.size()) * 1e9
+            / static_cast<double>(elapsed_ns);
+    report.m_median_wait = percentile(0.5);
+    report.m_p99_wait = percentile(0.99);
+    report.m_max_wait = std::chrono::nanoseconds { all_waits.back() };
+    return report;
+}
+
+/**
+ * @brief               Replays the trace against each of the given mutex types in order.
+ *
+ * @example             auto reports = ts::replay_trace_all<std::mutex, std::shared_mutex
+ *                              , spin_mutex>(trace);
+ * @tparam TMutexes     The mutex types.
+ * @return              The reports in the order of the mutex types.
+ */
+template <typename... TMutexes>
+std::array<replay_report, sizeof...(TMutexes)> replay_trace_all(const lock_trace& trace
+        , replay_options options = {})
+{
+    return { replay_trace<TMutexes>(trace, options)... };
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace ts
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#endif // THREADSAFESMARTPOINTERS_TS_LOCK_TRACE_H
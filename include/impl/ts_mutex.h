@@ -0,0 +1,1225 @@
+#ifndef THREADSAFESMARTPOINTERS_TS_MUTEX_H
+#define THREADSAFESMARTPOINTERS_TS_MUTEX_H
+
+/**
+ * @file        ts_mutex.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of mutex adapters and ordered locking.
+ * @date        10/18/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+
+#include <algorithm>
+#include <atomic>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <shared_mutex>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <pthread.h>
+#endif
+
+#include "impl/ts_config.h"
+#include "impl/ts_instrumentation.h"
+#include "impl/ts_thread_annotations.h"
+#include "ts_lock_order_exception.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace ts {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief       Checks the given type can be used as shared_mutex.
+ *
+ * @tparam T    The mutex type.
+ */
+template <typename T>
+concept is_shared_lockable = requires(T mtx)
+{
+    mtx.lock_shared();
+    mtx.unlock_shared();
+    { mtx.try_lock_shared() } -> std::same_as<bool>;
+};
+
+/**
+ * @brief       Checks the given mutex tracks the owner thread: ts::owner_aware_mutex or
+ *              ts::shared_ptr and ts::unique_ptr with ts::owner_aware_mutex.
+ *
+ * @tparam T    The mutex type.
+ */
+template <typename T>
+concept is_owner_aware_lockable = requires(T& mtx)
+{
+    { mtx.is_locked_by_current_thread() } -> std::same_as<bool>;
+};
+
+/**
+ * @internal
+ *
+ * @class           owner_aware_lock
+ * @brief           The RAII-style owner of the owner-aware mutex, which doesn't lock the mutex
+ *                  already held exclusively by the current thread, so the nested accesses don't
+ *                  deadlock.
+ *
+ * @tparam T        The mutex type.
+ * @tparam IsShared Locks the mutex for shared ownership if it isn't held by the current thread.
+ */
+template <typename T, bool IsShared = false>
+class owner_aware_lock
+{
+public:
+    using mutex_type = T;
+
+public:
+    explicit owner_aware_lock(T& mtx) TS_NO_THREAD_SAFETY_ANALYSIS
+        : m_mtx(&mtx)
+        , m_owns(!mtx.is_locked_by_current_thread())
+    {
+        if (m_owns)
+        {
+            if constexpr (IsShared)
+            {
+                m_mtx->lock_shared();
+            }
+            else
+            {
+                m_mtx->lock();
+            }
+        }
+    }
+
+    owner_aware_lock(owner_aware_lock&& other) noexcept
+        : m_mtx(std::exchange(other.m_mtx, nullptr))
+        , m_owns(std::exchange(other.m_owns, false))
+    {
+    }
+
+    ~owner_aware_lock() TS_NO_THREAD_SAFETY_ANALYSIS
+    {
+        if (m_owns)
+        {
+            if constexpr (IsShared)
+            {
+                m_mtx->unlock_shared();
+            }
+            else
+            {
+                m_mtx->unlock();
+            }
+        }
+    }
+
+    owner_aware_lock(const owner_aware_lock&) = delete;
+    owner_aware_lock& operator=(const owner_aware_lock&) = delete;
+    owner_aware_lock& operator=(owner_aware_lock&&) = delete;
+
+    [[nodiscard]] T* mutex() const noexcept
+    {
+        return m_mtx;
+    }
+
+private:
+    T* m_mtx = nullptr;
+    bool m_owns = false;
+}; // class owner_aware_lock
+
+/**
+ * @brief       Gets owner_aware_lock if T tracks the owner thread (shared if T is shared_mutex),
+ *              std::shared_lock if T is shared_mutex, otherwise std::unique_lock.
+ *
+ * @tparam T    The mutex type.
+ */
+template <typename T>
+using t_read_lock = std::conditional_t<is_owner_aware_lockable<T>
+        , owner_aware_lock<T, is_shared_lockable<T>>
+        , std::conditional_t<is_shared_lockable<T>
+                , std::shared_lock<T>
+                , std::unique_lock<T>>>;
+
+/**
+ * @brief       Define write lock, owner_aware_lock if T tracks the owner thread.
+ *
+ * @tparam T    The mutex type.
+ */
+template <typename T>
+using t_write_lock = std::conditional_t<is_owner_aware_lockable<T>
+        , owner_aware_lock<T>
+        , std::unique_lock<T>>;
+
+/**
+ * @brief   The position of the mutex in the lock hierarchy. The mutexes are acquired in the
+ *          ascending order of the rank, the mutexes of the same rank in the ascending order of
+ *          the address.
+ */
+struct lock_order_key
+{
+    std::size_t m_rank = 0;
+    const void* m_address = nullptr;
+
+    friend bool operator==(const lock_order_key&, const lock_order_key&) = default;
+
+    friend std::strong_ordering operator<=>(const lock_order_key& left
+            , const lock_order_key& right) noexcept
+    {
+        if (const auto result = left.m_rank <=> right.m_rank; result != 0)
+        {
+            return result;
+        }
+        return std::compare_three_way {}(left.m_address, right.m_address);
+    }
+};
+
+/**
+ * @brief       Checks the given lockable has the rank in the lock hierarchy: ts::ranked_mutex or
+ *              ts::shared_ptr and ts::unique_ptr with ts::ranked_mutex.
+ *
+ * @tparam T    The lockable type.
+ */
+template <typename T>
+concept is_ranked_lockable = requires(const T& lockable)
+{
+    { lock_order_key_of(lockable) } -> std::same_as<lock_order_key>;
+};
+
+/**
+ * @brief       Checks the lock of the given lockable may throw ts::lock_order_exception: the
+ *              lockable is ranked and the lock order is checked (debug builds). The locking
+ *              operations of ts::shared_ptr and ts::unique_ptr are noexcept only otherwise.
+ *
+ * @tparam T    The lockable type.
+ */
+template <typename T>
+constexpr bool lock_order_may_throw = config::s_check_lock_order && is_ranked_lockable<T>;
+
+/**
+ * @internal
+ * @brief   The debug registry of the ranked mutexes held by the current thread, ordered by the
+ *          position in the lock hierarchy.
+ */
+class lock_order_registry
+{
+public:
+    /**
+     * @brief   Checks the mutex could be acquired after the mutexes held by the thread: it should
+     *          follow the greatest held one, including the ones acquired by try_lock.
+     *
+     * @throws  ts::lock_order_exception if the hierarchy is violated.
+     */
+    static void check(const lock_order_key& key)
+    {
+        const auto& held = local();
+        if (!held.empty() && !(held.back() < key))
+        {
+            if constexpr (config::s_enable_exceptions)
+            {
+                throw lock_order_exception {
+                    "The ranked mutex is locked out of the rank order." };
+            }
+            else
+            {
+                std::terminate();
+            }
+        }
+    }
+
+    /**
+     * @brief   Registers the acquired mutex, the keys are kept sorted so the greatest one is the
+     *          last, the try_lock may acquire the mutexes out of order.
+     */
+    static void on_acquire(const lock_order_key& key)
+    {
+        auto& held = local();
+        held.insert(std::upper_bound(held.begin(), held.end(), key), key);
+    }
+
+    static void on_release(const lock_order_key& key) noexcept
+    {
+        auto& held = local();
+        const auto it = std::lower_bound(held.begin(), held.end(), key);
+        if (it != held.end() && *it == key)
+        {
+            held.erase(it);
+        }
+    }
+
+private:
+    static std::vector<lock_order_key>& local() noexcept
+    {
+        static thread_local std::vector<lock_order_key> s_held {};
+        return s_held;
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief           ts::ranked_mutex is a mutex adapter which has the fixed rank in the lock
+ *                  hierarchy.
+ *
+ * @details         The multi-lock operations of ts::shared_ptr and ts::unique_ptr with the ranked
+ *                  mutexes (assignment, comparison) acquire the mutexes directly in the rank
+ *                  order, without the retries of the std::lock deadlock avoidance algorithm.
+ *                  In the debug builds every lock checks the mutex follows all ranked mutexes
+ *                  held by the thread, including the ones acquired by try_lock: the rank should
+ *                  be greater, or the same with the greater address. The violation throws
+ *                  ts::lock_order_exception, so the locking operations of ts::shared_ptr and
+ *                  ts::unique_ptr with the ranked mutex are not noexcept in the debug builds.
+ *                  The mutexes of the same rank are ordered by the address, so two objects of
+ *                  the same type can be locked together by the multi-lock operations.
+ * @example         using t_account_mutex = ts::ranked_mutex<std::mutex, 10>;
+ *                  using t_ledger_mutex = ts::ranked_mutex<std::mutex, 20>;
+ *                  ts::shared_ptr<account, t_account_mutex> p_account { new account {} };
+ *                  ts::shared_ptr<ledger, t_ledger_mutex> p_ledger { new ledger {} };
+ *                  std::lock_guard account_lock { p_account };
+ *                  std::lock_guard ledger_lock { p_ledger }; // OK, 20 > 10.
+ * @tparam TMutex   The underlying mutex type.
+ * @tparam Rank     The rank of the mutex, the mutexes are acquired in the ascending order.
+ */
+template <typename TMutex, std::size_t Rank>
+class ranked_mutex
+{
+public:
+    using mutex_type = TMutex;
+
+    /**
+     * The rank of the mutex in the lock hierarchy.
+     */
+    static constexpr std::size_t s_rank = Rank;
+
+public:
+    ranked_mutex() = default;
+    ~ranked_mutex() = default;
+
+    /**
+     * Prevent copying and moving of an object.
+     */
+    ranked_mutex(const ranked_mutex&) = delete;
+    ranked_mutex(ranked_mutex&&) = delete;
+    ranked_mutex& operator=(const ranked_mutex&) = delete;
+    ranked_mutex& operator=(ranked_mutex&&) = delete;
+
+public:
+    /**
+     * @brief   Locks the mutex, blocks if the mutex is not available.
+     *
+     * @throws  ts::lock_order_exception in debug build if the thread holds the ranked mutex
+     *          which doesn't precede this one in the hierarchy.
+     */
+    void lock()
+    {
+        if constexpr (impl::config::s_check_lock_order)
+        {
+            impl::lock_order_registry::check(key());
+        }
+        m_mtx.lock();
+        if constexpr (impl::config::s_check_lock_order)
+        {
+            impl::lock_order_registry::on_acquire(key());
+        }
+    }
+
+    /**
+     * @brief   Tries to lock the mutex. Returns immediately, so it can't deadlock and isn't
+     *          checked, but the acquired mutex is registered for the checks of the later locks.
+     *
+     * @return  true if the lock was acquired successfully, otherwise false.
+     */
+    bool try_lock()
+    {
+        const bool locked = m_mtx.try_lock();
+        if constexpr (impl::config::s_check_lock_order)
+        {
+            if (locked)
+            {
+                impl::lock_order_registry::on_acquire(key());
+            }
+        }
+        return locked;
+    }
+
+    /**
+     * @brief   Unlocks the mutex.
+     */
+    void unlock()
+    {
+        if constexpr (impl::config::s_check_lock_order)
+        {
+            impl::lock_order_registry::on_release(key());
+        }
+        m_mtx.unlock();
+    }
+
+    /**
+     * @brief   Locks the mutex for shared ownership, checks the hierarchy as lock.
+     */
+    void lock_shared() requires(impl::is_shared_lockable<TMutex>)
+    {
+        if constexpr (impl::config::s_check_lock_order)
+        {
+            impl::lock_order_registry::check(key());
+        }
+        m_mtx.lock_shared();
+        if constexpr (impl::config::s_check_lock_order)
+        {
+            impl::lock_order_registry::on_acquire(key());
+        }
+    }
+
+    /**
+     * @brief   Tries to lock the mutex for shared ownership.
+     *
+     * @return  true if the lock was acquired successfully, otherwise false.
+     */
+    bool try_lock_shared() requires(impl::is_shared_lockable<TMutex>)
+    {
+        const bool locked = m_mtx.try_lock_shared();
+        if constexpr (impl::config::s_check_lock_order)
+        {
+            if (locked)
+            {
+                impl::lock_order_registry::on_acquire(key());
+            }
+        }
+        return locked;
+    }
+
+    /**
+     * @brief   Unlocks the mutex (shared ownership).
+     */
+    void unlock_shared() requires(impl::is_shared_lockable<TMutex>)
+    {
+        if constexpr (impl::config::s_check_lock_order)
+        {
+            impl::lock_order_registry::on_release(key());
+        }
+        m_mtx.unlock_shared();
+    }
+
+    /**
+     * @brief   Gets the position of the mutex in the lock hierarchy.
+     */
+    friend impl::lock_order_key lock_order_key_of(const ranked_mutex& mtx) noexcept
+    {
+        return mtx.key();
+    }
+
+private:
+    [[nodiscard]] impl::lock_order_key key() const noexcept
+    {
+        return impl::lock_order_key { Rank, this };
+    }
+
+private:
+    TMutex m_mtx {};
+}; // class ranked_mutex
+
+/**
+ * @brief           ts::owner_aware_mutex is a mutex adapter which remembers the owner thread, the
+ *                  cheap replacement of std::recursive_mutex for the nested accesses.
+ *
+ * @details         The structure dereference and subscript operators of ts::shared_ptr and
+ *                  ts::unique_ptr and acquire() don't lock the owner-aware mutex already held by
+ *                  the current thread, so the method of the object can call back through
+ *                  another handle of the same object without the deadlock. The owner is stored
+ *                  in the lock word next to the mutex and is compared with the current thread id
+ *                  without any synchronization: only the owner thread can write its own id.
+ *                  Unlike std::recursive_mutex there is no recursion counter, the lock()
+ *                  itself isn't reentrant, the outermost proxy object owns the lock.
+ *                  With the shared underlying mutex the read-only accesses lock it for shared
+ *                  ownership. Only the exclusive owner is remembered, so only the accesses
+ *                  nested in the exclusive access don't lock again; the nested read-only
+ *                  accesses take the shared lock again, as with std::shared_mutex.
+ * @example         struct node
+ *                  {
+ *                      ts::shared_ptr<node, ts::owner_aware_mutex<>> p_self;
+ *                      int value = 0;
+ *                      void increment() { ++value; }
+ *                      void update() { p_self->increment(); } // Doesn't lock again.
+ *                  };
+ *                  p_node->update();
+ * @warning         The lock()/unlock() of the owner-aware mutex are not reentrant, the nested
+ *                  std::lock_guard on the already held mutex deadlocks as with std::mutex.
+ * @tparam TMutex   The underlying mutex type (optional by default std::mutex).
+ */
+template <typename TMutex = std::mutex>
+class owner_aware_mutex
+{
+public:
+    using mutex_type = TMutex;
+
+public:
+    owner_aware_mutex() = default;
+    ~owner_aware_mutex() = default;
+
+    /**
+     * Prevent copying and moving of an object.
+     */
+    owner_aware_mutex(const owner_aware_mutex&) = delete;
+    owner_aware_mutex(owner_aware_mutex&&) = delete;
+    owner_aware_mutex& operator=(const owner_aware_mutex&) = delete;
+    owner_aware_mutex& operator=(owner_aware_mutex&&) = delete;
+
+public:
+    /**
+     * @brief   Locks the mutex, blocks if the mutex is not available.
+     */
+    void lock()
+    {
+        m_mtx.lock();
+        m_owner.store(std::this_thread::get_id(), std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief   Tries to lock the mutex.
+     *
+     * @return  true if the lock was acquired successfully, otherwise false.
+     */
+    bool try_lock()
+    {
+        if (!m_mtx.try_lock())
+        {
+            return false;
+        }
+        m_owner.store(std::this_thread::get_id(), std::memory_order_relaxed);
+        return true;
+    }
+
+    /**
+     * @brief   Unlocks the mutex.
+     */
+    void unlock()
+    {
+        m_owner.store(std::thread::id {}, std::memory_order_relaxed);
+        m_mtx.unlock();
+    }
+
+    /**
+     * @brief   Locks the mutex for shared ownership, the shared owners are not remembered.
+     */
+    void lock_shared() requires(impl::is_shared_lockable<TMutex>)
+    {
+        m_mtx.lock_shared();
+    }
+
+    /**
+     * @brief   Tries to lock the mutex for shared ownership.
+     *
+     * @return  true if the lock was acquired successfully, otherwise false.
+     */
+    bool try_lock_shared() requires(impl::is_shared_lockable<TMutex>)
+    {
+        return m_mtx.try_lock_shared();
+    }
+
+    /**
+     * @brief   Unlocks the mutex (shared ownership).
+     */
+    void unlock_shared() requires(impl::is_shared_lockable<TMutex>)
+    {
+        m_mtx.unlock_shared();
+    }
+
+    /**
+     * @brief   Checks the mutex is held exclusively by the current thread. The relaxed load is
+     *          enough, the current thread id could be stored only by the current thread.
+     *
+     * @return  true if the current thread is the owner, otherwise false.
+     */
+    [[nodiscard]] bool is_locked_by_current_thread() const noexcept
+    {
+        return m_owner.load(std::memory_order_relaxed) == std::this_thread::get_id();
+    }
+
+    /**
+     * @brief   Gets the position of the underlying ranked mutex in the lock hierarchy.
+     */
+    friend impl::lock_order_key lock_order_key_of(const owner_aware_mutex& mtx) noexcept
+            requires(impl::is_ranked_lockable<TMutex>)
+    {
+        return lock_order_key_of(mtx.m_mtx);
+    }
+
+private:
+    TMutex m_mtx {};
+    std::atomic<std::thread::id> m_owner {};
+}; // class owner_aware_mutex
+
+/**
+ * @brief           ts::contention_aware_mutex is a mutex adapter which counts the threads
+ *                  waiting for the mutex, so the long-running holder can let them through.
+ *
+ * @details         The uncontended lock is the try_lock of the underlying mutex, only the threads
+ *                  which failed it are counted as waiters. The lock token of ts::shared_ptr and
+ *                  ts::unique_ptr with the contention-aware mutex provides yield_if_contended(),
+ *                  which releases the lock only if there are waiters, waits until one of them
+ *                  acquires the mutex and reacquires it. Without the waiters it is a single
+ *                  relaxed load.
+ * @example         ts::shared_ptr<storage, ts::contention_aware_mutex<>> p_storage { ... };
+ *                  auto storage = p_storage.acquire();
+ *                  for (auto& segment : storage->segments())
+ *                  {
+ *                      segment.compact();
+ *                      storage.yield_if_contended(); // Lets the request threads through.
+ *                  }
+ * @tparam TMutex   The underlying mutex type (optional by default std::mutex).
+ */
+template <typename TMutex = std::mutex>
+class contention_aware_mutex
+{
+public:
+    using mutex_type = TMutex;
+
+public:
+    contention_aware_mutex() = default;
+    ~contention_aware_mutex() = default;
+
+    /**
+     * Prevent copying and moving of an object.
+     */
+    contention_aware_mutex(const contention_aware_mutex&) = delete;
+    contention_aware_mutex(contention_aware_mutex&&) = delete;
+    contention_aware_mutex& operator=(const contention_aware_mutex&) = delete;
+    contention_aware_mutex& operator=(contention_aware_mutex&&) = delete;
+
+public:
+    /**
+     * @brief   Locks the mutex, blocks if the mutex is not available.
+     */
+    void lock()
+    {
+        if (!m_mtx.try_lock())
+        {
+            m_waiters.fetch_add(1, std::memory_order_relaxed);
+            m_mtx.lock();
+            on_waited();
+        }
+    }
+
+    /**
+     * @brief   Tries to lock the mutex, the failed attempt isn't counted as the waiter.
+     *
+     * @return  true if the lock was acquired successfully, otherwise false.
+     */
+    bool try_lock()
+    {
+        return m_mtx.try_lock();
+    }
+
+    /**
+     * @brief   Unlocks the mutex.
+     */
+    void unlock()
+    {
+        m_mtx.unlock();
+    }
+
+    /**
+     * @brief   Locks the mutex for shared ownership, blocks if the mutex is not available.
+     */
+    void lock_shared() requires(impl::is_shared_lockable<TMutex>)
+    {
+        if (!m_mtx.try_lock_shared())
+        {
+            m_waiters.fetch_add(1, std::memory_order_relaxed);
+            m_mtx.lock_shared();
+            on_waited();
+        }
+    }
+
+    /**
+     * @brief   Tries to lock the mutex for shared ownership.
+     *
+     * @return  true if the lock was acquired successfully, otherwise false.
+     */
+    bool try_lock_shared() requires(impl::is_shared_lockable<TMutex>)
+    {
+        return m_mtx.try_lock_shared();
+    }
+
+    /**
+     * @brief   Unlocks the mutex (shared ownership).
+     */
+    void unlock_shared() requires(impl::is_shared_lockable<TMutex>)
+    {
+        m_mtx.unlock_shared();
+    }
+
+    /**
+     * @brief   Checks there are threads blocked on the mutex.
+     *
+     * @return  true if there are waiters, otherwise false.
+     */
+    [[nodiscard]] bool has_waiters() const noexcept
+    {
+        return m_waiters.load(std::memory_order_relaxed) != 0;
+    }
+
+    /**
+     * @brief   Gets the number of the lock acquisitions by the waiters, used for detecting the
+     *          mutex is handed off to the waiter.
+     *
+     * @return  The number of the handoffs.
+     */
+    [[nodiscard]] std::size_t handoff_count() const noexcept
+    {
+        return m_handoffs.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief   Gets the position of the underlying ranked mutex in the lock hierarchy.
+     */
+    friend impl::lock_order_key lock_order_key_of(const contention_aware_mutex& mtx) noexcept
+            requires(impl::is_ranked_lockable<TMutex>)
+    {
+        return lock_order_key_of(mtx.m_mtx);
+    }
+
+private:
+    void on_waited() noexcept
+    {
+        m_waiters.fetch_sub(1, std::memory_order_relaxed);
+        m_handoffs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+private:
+    TMutex m_mtx {};
+    std::atomic<std::size_t> m_waiters { 0 };
+    std::atomic<std::size_t> m_handoffs { 0 };
+}; // class contention_aware_mutex
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief       Checks the given mutex counts the waiters: ts::contention_aware_mutex or
+ *              ts::shared_ptr and ts::unique_ptr with ts::contention_aware_mutex.
+ *
+ * @tparam T    The mutex type.
+ */
+template <typename T>
+concept is_contention_aware_lockable = requires(T& mtx)
+{
+    { mtx.has_waiters() } -> std::same_as<bool>;
+    { mtx.handoff_count() } -> std::same_as<std::size_t>;
+};
+
+/**
+ * @internal
+ * @brief       Releases the held lock if there are waiters, waits until the mutex is handed off
+ *              to one of them (or they are gone) and reacquires the lock.
+ *
+ * @param lock  The lock which holds the mutex.
+ * @param mtx   The contention-aware mutex.
+ * @return      true if the lock was released, otherwise false.
+ */
+template <typename TLock, typename TMutex>
+bool yield_if_contended(TLock& lock, const TMutex& mtx)
+{
+    if (!mtx.has_waiters())
+    {
+        return false;
+    }
+    const std::size_t handoffs = mtx.handoff_count();
+    lock.unlock();
+    while (mtx.has_waiters() && mtx.handoff_count() == handoffs)
+    {
+        std::this_thread::yield();
+    }
+    lock.lock();
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(__unix__) || defined(__APPLE__)
+
+/**
+ * @brief   ts::pi_mutex is the POSIX mutex with the priority inheritance protocol
+ *          (PTHREAD_PRIO_INHERIT, FUTEX_LOCK_PI on Linux): the thread holding the mutex runs at
+ *          the priority of the highest priority thread waiting for it. The low-priority holder
+ *          can't be preempted by the medium-priority threads, so the wait of the real-time
+ *          thread is bounded by the critical section.
+ *
+ * @details The inheritance takes effect for the real-time scheduling policies (SCHED_FIFO,
+ *          SCHED_RR), for the other threads it is std::mutex with the kernel-arbitrated
+ *          contended path. Available only on the POSIX platforms.
+ * @example ts::unique_ptr<audio_state, ts::pi_mutex> p_state { new audio_state {} };
+ *          // Both the real-time audio thread and the normal-priority UI thread.
+ *          p_state->set_gain(gain);
+ * @warning The mutex should be unlocked by the thread which locked it.
+ */
+class pi_mutex
+{
+public:
+    using native_handle_type = ::pthread_mutex_t*;
+
+public:
+    /**
+     * @throws  std::system_error if the system doesn't support the priority inheritance.
+     */
+    pi_mutex()
+    {
+        ::pthread_mutexattr_t attributes;
+        check(::pthread_mutexattr_init(&attributes), "Failed to initialize the mutex attributes.");
+        // The error-checking type reports the relock by the owner instead of the deadlock.
+        int error = ::pthread_mutexattr_settype(&attributes, PTHREAD_MUTEX_ERRORCHECK);
+        if (0 == error)
+        {
+            error = ::pthread_mutexattr_setprotocol(&attributes, PTHREAD_PRIO_INHERIT);
+        }
+        if (0 == error)
+        {
+            error = ::pthread_mutex_init(&m_mtx, &attributes);
+        }
+        ::pthread_mutexattr_destroy(&attributes);
+        check(error, "Failed to initialize the priority inheritance mutex.");
+    }
+
+    ~pi_mutex()
+    {
+        ::pthread_mutex_destroy(&m_mtx);
+    }
+
+    /**
+     * Prevent copying and moving of an object.
+     */
+    pi_mutex(const pi_mutex&) = delete;
+    pi_mutex(pi_mutex&&) = delete;
+    pi_mutex& operator=(const pi_mutex&) = delete;
+    pi_mutex& operator=(pi_mutex&&) = delete;
+
+public:
+    /**
+     * @brief   Locks the mutex, blocks if the mutex is not available.
+     *
+     * @throws  std::system_error if the mutex is already held by the current thread.
+     */
+    void lock()
+    {
+        check(::pthread_mutex_lock(&m_mtx), "Failed to lock the priority inheritance mutex.");
+    }
+
+    /**
+     * @brief   Tries to lock the mutex.
+     *
+     * @return  true if the lock was acquired successfully, otherwise false.
+     */
+    bool try_lock() noexcept
+    {
+        return 0 == ::pthread_mutex_trylock(&m_mtx);
+    }
+
+    /**
+     * @brief   Unlocks the mutex.
+     */
+    void unlock() noexcept
+    {
+        ::pthread_mutex_unlock(&m_mtx);
+    }
+
+    [[nodiscard]] native_handle_type native_handle() noexcept
+    {
+        return &m_mtx;
+    }
+
+private:
+    static void check(int error, const char* message)
+    {
+        if (0 != error)
+        {
+            if constexpr (impl::config::s_enable_exceptions)
+            {
+                throw std::system_error { error, std::generic_category(), message };
+            }
+            else
+            {
+                std::terminate();
+            }
+        }
+    }
+
+private:
+    ::pthread_mutex_t m_mtx {};
+}; // class pi_mutex
+
+#endif
+
+/**
+ * @brief           ts::instrumented_mutex is a mutex adapter which measures the wait and hold
+ *                  durations of every acquisition for the diagnostics (ts_diagnostics.h).
+ *
+ * @details         The acquisitions are timed only while any diagnostics sink is active, e.g.
+ *                  the ts::lock_trace_recorder records, otherwise the overhead is a relaxed load
+ *                  on the lock and the check of the timed acquisition flag on the unlock.
+ *                  The contended acquisitions are counted while ts::contention_monitor is alive,
+ *                  the lock order of the ranked mutexes is checked before the try_lock.
+ *                  The stacks of the contended acquisitions are captured while
+ *                  ts::contention_profiler is alive, if THREADSAFESMARTPOINTERS_PROFILE_CONTENTION
+ *                  is defined.
+ *                  The adapter forwards the shared locking and the capabilities of the other
+ *                  adapters, so it can wrap any of them. With the
+ *                  THREADSAFESMARTPOINTERS_INSTRUMENT_LOCKS macro defined, the mutexes of all
+ *                  ts::shared_ptr and ts::unique_ptr are instrumented.
+ * @example         ts::shared_ptr<std::map<int, int>, ts::instrumented_mutex<std::shared_mutex>>
+ *                      p_map { new std::map<int, int> {} };
+ * @tparam TMutex   The underlying mutex type (optional by default std::mutex).
+ */
+template <typename TMutex = std::mutex>
+class instrumented_mutex
+{
+public:
+    using mutex_type = TMutex;
+
+public:
+    instrumented_mutex() = default;
+    ~instrumented_mutex() = default;
+
+    /**
+     * Prevent copying and moving of an object.
+     */
+    instrumented_mutex(const instrumented_mutex&) = delete;
+    instrumented_mutex(instrumented_mutex&&) = delete;
+    instrumented_mutex& operator=(const instrumented_mutex&) = delete;
+    instrumented_mutex& operator=(instrumented_mutex&&) = delete;
+
+public:
+    /**
+     * @brief   Locks the mutex, blocks if the mutex is not available.
+     */
+    void lock()
+    {
+        if (!impl::lock_probe::is_active())
+        {
+            m_mtx.lock();
+            return;
+        }
+        const std::uint64_t request_ns = impl::now_ns();
+        if constexpr (impl::config::s_check_lock_order && impl::is_ranked_lockable<TMutex>)
+        {
+            // The try_lock of the ranked mutex isn't checked, so the hierarchy is checked first.
+            impl::lock_order_registry::check(lock_order_key_of(m_mtx));
+        }
+        if (!m_mtx.try_lock())
+        {
+            m_diagnostics.on_contended();
+            m_mtx.lock();
+            m_diagnostics.on_contended_acquired(request_ns);
+        }
+        m_diagnostics.on_exclusive_acquired();
+        impl::lock_probe::on_acquired(this, impl::access_mode::exclusive, request_ns
+                , impl::now_ns());
+        m_is_probed = true;
+    }
+
+    /**
+     * @brief   Tries to lock the mutex.
+     *
+     * @return  true if the lock was acquired successfully, otherwise false.
+     */
+    bool try_lock()
+    {
+        const bool is_active = impl::lock_probe::is_active();
+        const std::uint64_t request_ns = is_active ? impl::now_ns() : 0;
+        if (!m_mtx.try_lock())
+        {
+            if (is_active)
+            {
+                impl::lock_probe::on_failed();
+            }
+            return false;
+        }
+        if (is_active)
+        {
+            m_diagnostics.on_exclusive_acquired();
+            impl::lock_probe::on_acquired(this, impl::access_mode::exclusive, request_ns
+                    , impl::now_ns());
+            m_is_probed = true;
+        }
+        return true;
+    }
+
+    /**
+     * @brief   Unlocks the mutex.
+     */
+    void unlock()
+    {
+        if (m_is_probed)
+        {
+            m_is_probed = false;
+            impl::lock_probe::on_released(this);
+        }
+        m_mtx.unlock();
+    }
+
+    /**
+     * @brief   Locks the mutex for shared ownership, blocks if the mutex is not available.
+     */
+    void lock_shared() requires(impl::is_shared_lockable<TMutex>)
+    {
+        if (!impl::lock_probe::is_active())
+        {
+            m_mtx.lock_shared();
+            return;
+        }
+        const std::uint64_t request_ns = impl::now_ns();
+        if constexpr (impl::config::s_check_lock_order && impl::is_ranked_lockable<TMutex>)
+        {
+            // The try_lock of the ranked mutex isn't checked, so the hierarchy is checked first.
+            impl::lock_order_registry::check(lock_order_key_of(m_mtx));
+        }
+        if (!m_mtx.try_lock_shared())
+        {
+            m_diagnostics.on_contended();
+            m_mtx.lock_shared();
+            m_diagnostics.on_contended_acquired(request_ns);
+        }
+        impl::lock_probe::on_acquired(this, impl::access_mode::shared, request_ns
+                , impl::now_ns());
+        m_probed_shared_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief   Tries to lock the mutex for shared ownership.
+     *
+     * @return  true if the lock was acquired successfully, otherwise false.
+     */
+    bool try_lock_shared() requires(impl::is_shared_lockable<TMutex>)
+    {
+        const bool is_active = impl::lock_probe::is_active();
+        const std::uint64_t request_ns = is_active ? impl::now_ns() : 0;
+        if (!m_mtx.try_lock_shared())
+        {
+            if (is_active)
+            {
+                impl::lock_probe::on_failed();
+            }
+            return false;
+        }
+        if (is_active)
+        {
+            impl::lock_probe::on_acquired(this, impl::access_mode::shared, request_ns
+                    , impl::now_ns());
+            m_probed_shared_count.fetch_add(1, std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+    /**
+     * @brief   Unlocks the mutex (shared ownership).
+     */
+    void unlock_shared() requires(impl::is_shared_lockable<TMutex>)
+    {
+        if (0 != m_probed_shared_count.load(std::memory_order_relaxed)
+                && impl::lock_probe::on_released(this))
+        {
+            m_probed_shared_count.fetch_sub(1, std::memory_order_relaxed);
+        }
+        m_mtx.unlock_shared();
+    }
+
+    /**
+     * @brief   Checks the underlying owner-aware mutex is held by the current thread.
+     */
+    [[nodiscard]] bool is_locked_by_current_thread() const noexcept
+            requires(impl::is_owner_aware_lockable<const TMutex>)
+    {
+        return m_mtx.is_locked_by_current_thread();
+    }
+
+    /**
+     * @brief   Checks there are threads waiting for the underlying contention-aware mutex.
+     */
+    [[nodiscard]] bool has_waiters() const noexcept
+            requires(impl::is_contention_aware_lockable<const TMutex>)
+    {
+        return m_mtx.has_waiters();
+    }
+
+    /**
+     * @brief   Gets the number of the handoffs of the underlying contention-aware mutex.
+     */
+    [[nodiscard]] std::size_t handoff_count() const noexcept
+            requires(impl::is_contention_aware_lockable<const TMutex>)
+    {
+        return m_mtx.handoff_count();
+    }
+
+    /**
+     * @brief   Gets the position of the underlying ranked mutex in the lock hierarchy.
+     */
+    friend impl::lock_order_key lock_order_key_of(const instrumented_mutex& mtx) noexcept
+            requires(impl::is_ranked_lockable<TMutex>)
+    {
+        return lock_order_key_of(mtx.m_mtx);
+    }
+
+    /**
+     * @brief   Gets the diagnostic state of the mutex, used by ts::set_lock_name and the reports.
+     */
+    friend impl::mutex_diagnostics& mutex_diagnostics_of(const instrumented_mutex& mtx) noexcept
+    {
+        return mtx.m_diagnostics;
+    }
+
+private:
+    TMutex m_mtx {};
+    bool m_is_probed = false;
+    std::atomic<std::uint32_t> m_probed_shared_count { 0 };
+    mutable impl::mutex_diagnostics m_diagnostics { &m_mtx };
+}; // class instrumented_mutex
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief       Checks the given lockable is instrumented: ts::instrumented_mutex or ts::shared_ptr
+ *              and ts::unique_ptr with ts::instrumented_mutex.
+ *
+ * @tparam T    The lockable type.
+ */
+template <typename T>
+concept is_instrumented_lockable = requires(const T& lockable)
+{
+    { mutex_diagnostics_of(lockable) } -> std::same_as<mutex_diagnostics&>;
+};
+
+/**
+ * @internal
+ * @brief       Gets the mutex type of ts::shared_ptr and ts::unique_ptr: ts::instrumented_mutex
+ *              if all locks are instrumented, otherwise T.
+ *
+ * @tparam T    The mutex type.
+ */
+template <typename T>
+struct pointer_mutex
+{
+    using type = std::conditional_t<config::s_instrument_locks, instrumented_mutex<T>, T>;
+};
+
+template <typename T>
+struct pointer_mutex<instrumented_mutex<T>>
+{
+    using type = instrumented_mutex<T>;
+};
+
+template <typename T>
+using t_pointer_mutex = typename pointer_mutex<T>::type;
+
+/**
+ * @internal
+ *
+ * @class           ordered_lock
+ * @brief           The RAII-style owner of two lockable objects, the replacement of the
+ *                  std::scoped_lock for the multi-lock operations.
+ *
+ * @details         If both lockables are ranked, they are acquired directly in the order of the
+ *                  lock hierarchy, the lockables which share the same mutex are locked once.
+ *                  Otherwise the std::lock deadlock avoidance algorithm is used.
+ * @tparam TFirst   The type of the first lockable.
+ * @tparam TSecond  The type of the second lockable.
+ */
+template <typename TFirst, typename TSecond>
+class ordered_lock
+{
+    static constexpr bool s_is_ranked = is_ranked_lockable<TFirst>
+            && is_ranked_lockable<TSecond>;
+
+public:
+    ordered_lock(TFirst& first, TSecond& second) TS_NO_THREAD_SAFETY_ANALYSIS
+        : m_first(first)
+        , m_second(second)
+    {
+        if constexpr (s_is_ranked)
+        {
+            const lock_order_key first_key = lock_order_key_of(first);
+            const lock_order_key second_key = lock_order_key_of(second);
+            m_is_same = (first_key == second_key);
+            if (m_is_same || first_key < second_key)
+            {
+                m_first.lock();
+                if (!m_is_same)
+                {
+                    lock_or_release(m_second, m_first);
+                }
+            }
+            else
+            {
+                m_second.lock();
+                lock_or_release(m_first, m_second);
+            }
+        }
+        else
+        {
+            std::lock(m_first, m_second);
+        }
+    }
+
+    ~ordered_lock() TS_NO_THREAD_SAFETY_ANALYSIS
+    {
+        m_first.unlock();
+        if (!m_is_same)
+        {
+            m_second.unlock();
+        }
+    }
+
+    ordered_lock(const ordered_lock&) = delete;
+    ordered_lock(ordered_lock&&) = delete;
+    ordered_lock& operator=(const ordered_lock&) = delete;
+    ordered_lock& operator=(ordered_lock&&) = delete;
+
+private:
+    /**
+     * @internal
+     * @brief   Locks the next lockable, releases the already held one if the lock throws.
+     */
+    template <typename TNext, typename THeld>
+    static void lock_or_release(TNext& next, THeld& held) TS_NO_THREAD_SAFETY_ANALYSIS
+    {
+        try
+        {
+            next.lock();
+        }
+        catch (...)
+        {
+            held.unlock();
+            throw;
+        }
+    }
+
+private:
+    TFirst& m_first;
+    TSecond& m_second;
+    bool m_is_same = false;
+}; // class ordered_lock
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace ts
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#endif // THREADSAFESMARTPOINTERS_TS_MUTEX_H
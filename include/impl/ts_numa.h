@@ -0,0 +1,175 @@
+#ifndef THREADSAFESMARTPOINTERS_TS_NUMA_H
+#define THREADSAFESMARTPOINTERS_TS_NUMA_H
+
+/**
+ * @file        ts_numa.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of NUMA topology detection.
+ * @date        10/18/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace ts::impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @internal
+ *
+ * @class       numa_topology
+ * @brief       The NUMA nodes of the machine and the mapping of the CPUs to the nodes.
+ *
+ * @details     On Linux the topology is read once from /sys/devices/system/node, the current
+ *              CPU is taken by sched_getcpu. On other platforms, or if the topology is not
+ *              available, the machine is a single node.
+ */
+class numa_topology
+{
+public:
+    /**
+     * @brief   Gets the topology of the machine, detected on the first call.
+     */
+    static const numa_topology& instance()
+    {
+        static const numa_topology s_topology {};
+        return s_topology;
+    }
+
+    numa_topology(const numa_topology&) = delete;
+    numa_topology(numa_topology&&) = delete;
+    numa_topology& operator=(const numa_topology&) = delete;
+    numa_topology& operator=(numa_topology&&) = delete;
+    ~numa_topology() = default;
+
+    /**
+     * @brief   Gets the count of the NUMA nodes, at least 1.
+     */
+    [[nodiscard]] std::size_t node_count() const noexcept
+    {
+        return m_node_count;
+    }
+
+    /**
+     * @brief   Gets the count of the CPUs, at least 1.
+     */
+    [[nodiscard]] std::size_t cpu_count() const noexcept
+    {
+        return m_cpu_to_node.size();
+    }
+
+    /**
+     * @brief   Gets the CPU the current thread runs on, 0 if unknown.
+     */
+    [[nodiscard]] std::size_t current_cpu() const noexcept
+    {
+#if defined(__linux__)
+        const int cpu = ::sched_getcpu();
+        if (cpu >= 0)
+        {
+            return static_cast<std::size_t>(cpu) % m_cpu_to_node.size();
+        }
+#endif
+        return 0;
+    }
+
+    /**
+     * @brief   Gets the NUMA node of the given CPU.
+     */
+    [[nodiscard]] std::size_t node_of(std::size_t cpu) const noexcept
+    {
+        return m_cpu_to_node[cpu % m_cpu_to_node.size()];
+    }
+
+private:
+    numa_topology()
+        : m_cpu_to_node(std::max(1u, std::thread::hardware_concurrency()), 0)
+    {
+#if defined(__linux__)
+        const std::string root = "/sys/devices/system/node/";
+        std::size_t node_index = 0;
+        for (const std::size_t node : parse_list(read_line(root + "online")))
+        {
+            const auto cpus = parse_list(read_line(root + "node" + std::to_string(node)
+                    + "/cpulist"));
+            if (cpus.empty())
+            {
+                continue;
+            }
+            for (const std::size_t cpu : cpus)
+            {
+                if (cpu >= m_cpu_to_node.size())
+                {
+                    m_cpu_to_node.resize(cpu + 1, 0);
+                }
+                m_cpu_to_node[cpu] = node_index;
+            }
+            ++node_index;
+        }
+        m_node_count = std::max<std::size_t>(1, node_index);
+#endif
+    }
+
+    static std::string read_line(const std::string& path)
+    {
+        std::ifstream file { path };
+        std::string line;
+        std::getline(file, line);
+        return line;
+    }
+
+    /**
+     * @internal
+     * @brief   Parses the Linux list format, e.g. "0-3,8-11".
+     */
+    static std::vector<std::size_t> parse_list(const std::string& list)
+    {
+        std::vector<std::size_t> values;
+        std::stringstream stream { list };
+        std::string range;
+        while (std::getline(stream, range, ','))
+        {
+            try
+            {
+                const auto dash = range.find('-');
+                const std::size_t first = std::stoul(range.substr(0, dash));
+                const std::size_t last = (dash == std::string::npos)
+                        ? first
+                        : std::stoul(range.substr(dash + 1));
+                for (std::size_t value = first; value <= last; ++value)
+                {
+                    values.push_back(value);
+                }
+            }
+            catch (const std::exception&)
+            {
+                return {};
+            }
+        }
+        return values;
+    }
+
+private:
+    std::vector<std::size_t> m_cpu_to_node;
+    std::size_t m_node_count = 1;
+}; // class numa_topology
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace ts::impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#endif // THREADSAFESMARTPOINTERS_TS_NUMA_H
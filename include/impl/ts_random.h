@@ -0,0 +1,55 @@
+#ifndef THREADSAFESMARTPOINTERS_TS_RANDOM_H
+#define THREADSAFESMARTPOINTERS_TS_RANDOM_H
+
+/**
+ * @file        ts_random.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of cheap thread-local pseudo-random generator.
+ * @date        10/18/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace ts::impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @internal
+ * @brief   Generates the next pseudo-random number using the thread-local xorshift generator.
+ *          The generator is not suitable for cryptography, it is used for the load balancing
+ *          and the sampling decisions only.
+ *
+ * @return  The pseudo-random number.
+ */
+inline std::uint64_t thread_local_random() noexcept
+{
+    static thread_local std::uint64_t s_state = std::hash<const void*> {}(&s_state) | 1;
+    s_state ^= s_state << 13;
+    s_state ^= s_state >> 7;
+    s_state ^= s_state << 17;
+    return s_state;
+}
+
+/**
+ * @internal
+ * @brief       Generates the pseudo-random number in the range [0, bound).
+ *
+ * @param bound The upper bound of the range, should not be zero.
+ * @return      The pseudo-random number.
+ */
+inline std::size_t thread_local_random(std::size_t bound) noexcept
+{
+    return static_cast<std::size_t>(thread_local_random() % bound);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace ts::impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#endif // THREADSAFESMARTPOINTERS_TS_RANDOM_H
@@ -0,0 +1,171 @@
+#ifndef THREADSAFESMARTPOINTERS_TS_RANGE_LOCK_H
+#define THREADSAFESMARTPOINTERS_TS_RANGE_LOCK_H
+
+/**
+ * @file        ts_range_lock.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the interval range locks of the arrays.
+ * @date        10/18/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+
+#include "impl/ts_config.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace ts::impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @internal
+ *
+ * @class       range_lock_table
+ * @brief       The table of the locked and requested [begin, end) ranges of all arrays, keyed by
+ *              the address of the array and striped by it.
+ *
+ * @details     The range is granted if it doesn't conflict with the granted ranges and with the
+ *              earlier requests which are still waiting (FIFO fairness), so the exclusive range
+ *              is not starved by the stream of the shared ones. Two ranges conflict if they
+ *              overlap and one of them is exclusive. The request waits for the grant on the
+ *              condition variable of the stripe.
+ *
+ *              Every lock and unlock takes the stripe mutex and allocates or frees the node of
+ *              the list, and the grant check scans all ranges of the stripe. The unlock wakes all
+ *              waiters of the stripe, including the ones of the other arrays hashed to it, and
+ *              each of them scans the list again, so the unlock costs O(waiters * ranges) under
+ *              the stripe mutex. The table suits the coarse ranges held for the long operations
+ *              (e.g. I/O), not the fine-grained locking of the hot loops.
+ */
+class range_lock_table
+{
+    struct range
+    {
+        const void* m_array = nullptr;
+        std::size_t m_begin = 0;
+        std::size_t m_end = 0;
+        std::uint64_t m_ticket = 0;
+        bool m_is_shared = false;
+        bool m_is_granted = false;
+    };
+
+    struct alignas(config::s_cache_line_size) stripe
+    {
+        std::mutex m_mtx {};
+        std::condition_variable m_cv {};
+        std::list<range> m_ranges {};
+        std::uint64_t m_next_ticket = 0;
+    };
+
+    static constexpr std::size_t s_stripe_count = 64;
+
+public:
+    using handle = std::list<range>::iterator;
+
+public:
+    static range_lock_table& instance()
+    {
+        static range_lock_table s_table {};
+        return s_table;
+    }
+
+    /**
+     * @brief   Blocks until the range of the array is granted.
+     *
+     * @return  The handle of the granted range for unlock().
+     */
+    handle lock(const void* p_array, std::size_t begin, std::size_t end, bool is_shared)
+    {
+        stripe& target = stripe_of(p_array);
+        std::unique_lock lock { target.m_mtx };
+        const handle request = target.m_ranges.insert(target.m_ranges.end()
+                , range { p_array, begin, end, target.m_next_ticket++, is_shared, false });
+        target.m_cv.wait(lock, [&target, request]() { return can_grant(target, *request); });
+        request->m_is_granted = true;
+        return request;
+    }
+
+    void unlock(const void* p_array, handle granted) noexcept
+    {
+        stripe& target = stripe_of(p_array);
+        {
+            std::lock_guard lock { target.m_mtx };
+            target.m_ranges.erase(granted);
+        }
+        // The waiters granted by the erase are unknown, all of them recheck.
+        target.m_cv.notify_all();
+    }
+
+private:
+    range_lock_table() = default;
+
+    stripe& stripe_of(const void* p_array) noexcept
+    {
+        return m_stripes[std::hash<const void*> {}(p_array) % s_stripe_count];
+    }
+
+    static bool can_grant(const stripe& target, const range& request) noexcept
+    {
+        for (const range& other : target.m_ranges)
+        {
+            if (&other == &request || other.m_array != request.m_array
+                    || other.m_end <= request.m_begin || request.m_end <= other.m_begin
+                    || (other.m_is_shared && request.m_is_shared))
+            {
+                continue;
+            }
+            if (other.m_is_granted || other.m_ticket < request.m_ticket)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    std::array<stripe, s_stripe_count> m_stripes {};
+}; // class range_lock_table
+
+/**
+ * @internal
+ *
+ * @class       range_guard
+ * @brief       The RAII-style owner of the range of the array.
+ */
+class range_guard
+{
+public:
+    range_guard(const void* p_array, std::size_t begin, std::size_t end, bool is_shared)
+        : m_p_array(p_array)
+        , m_handle(range_lock_table::instance().lock(p_array, begin, end, is_shared))
+    {
+    }
+
+    ~range_guard()
+    {
+        range_lock_table::instance().unlock(m_p_array, m_handle);
+    }
+
+    range_guard(const range_guard&) = delete;
+    range_guard(range_guard&&) = delete;
+    range_guard& operator=(const range_guard&) = delete;
+    range_guard& operator=(range_guard&&) = delete;
+
+private:
+    const void* m_p_array;
+    range_lock_table::handle m_handle;
+}; // class range_guard
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace ts::impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#endif // THREADSAFESMARTPOINTERS_TS_RANGE_LOCK_H
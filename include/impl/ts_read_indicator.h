@@ -0,0 +1,136 @@
+#ifndef THREADSAFESMARTPOINTERS_TS_READ_INDICATOR_H
+#define THREADSAFESMARTPOINTERS_TS_READ_INDICATOR_H
+
+/**
+ * @file        ts_read_indicator.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of scalable reader counter.
+ * @date        10/18/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+#include "impl/ts_config.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace ts::impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @internal
+ *
+ * @class       read_indicator
+ * @brief       Counts the active readers, the counter is striped between the cache lines to
+ *              avoid the contention of the readers on the single atomic.
+ *
+ * @details     The reader arrives and departs on the stripe chosen by the thread, the writer
+ *              waits until all stripes are zero. Arrive and depart are wait-free.
+ */
+class read_indicator
+{
+    /**
+     * @internal
+     * @brief   The counter padded to the cache line.
+     */
+    struct alignas(config::s_cache_line_size) stripe
+    {
+        std::atomic<std::int64_t> m_count { 0 };
+    };
+
+public:
+    /**
+     * @brief   Constructs the indicator, the count of stripes is based on the hardware
+     *          concurrency.
+     */
+    read_indicator()
+        : m_stripe_count(std::max(1u, std::thread::hardware_concurrency()))
+        , m_stripes(std::make_unique<stripe[]>(m_stripe_count))
+    {
+    }
+
+    read_indicator(const read_indicator&) = delete;
+    read_indicator(read_indicator&&) = delete;
+    read_indicator& operator=(const read_indicator&) = delete;
+    read_indicator& operator=(read_indicator&&) = delete;
+    ~read_indicator() = default;
+
+    /**
+     * @brief   Registers the reader of the current thread.
+     */
+    void arrive() noexcept
+    {
+        local_stripe().m_count.fetch_add(1, std::memory_order_seq_cst);
+    }
+
+    /**
+     * @brief   Unregisters the reader of the current thread.
+     */
+    void depart() noexcept
+    {
+        local_stripe().m_count.fetch_sub(1, std::memory_order_release);
+    }
+
+    /**
+     * @brief   Checks there are no active readers.
+     *
+     * @return  true if no reader is registered, otherwise false.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        for (std::size_t i = 0; i < m_stripe_count; ++i)
+        {
+            if (0 != m_stripes[i].m_count.load(std::memory_order_seq_cst))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief   Waits until there are no active readers.
+     */
+    void wait_empty() const noexcept
+    {
+        while (!empty())
+        {
+            std::this_thread::yield();
+        }
+    }
+
+private:
+    stripe& local_stripe() noexcept
+    {
+        return m_stripes[thread_index() % m_stripe_count];
+    }
+
+    /**
+     * @internal
+     * @brief   Gets the sequential index of the current thread.
+     */
+    static std::size_t thread_index() noexcept
+    {
+        static std::atomic<std::size_t> s_next_index { 0 };
+        static thread_local const std::size_t s_index
+                = s_next_index.fetch_add(1, std::memory_order_relaxed);
+        return s_index;
+    }
+
+private:
+    const std::size_t m_stripe_count;
+    std::unique_ptr<stripe[]> m_stripes;
+}; // class read_indicator
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace ts::impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#endif // THREADSAFESMARTPOINTERS_TS_READ_INDICATOR_H
@@ -0,0 +1,433 @@
+#ifndef THREADSAFESMARTPOINTERS_TS_RELAXED_PRIORITY_QUEUE_H
+#define THREADSAFESMARTPOINTERS_TS_RELAXED_PRIORITY_QUEUE_H
+
+/**
+ * @file        ts_relaxed_priority_queue.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of relaxed concurrent priority queue.
+ * @date        10/18/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "impl/ts_config.h"
+#include "impl/ts_random.h"
+#include "impl/ts_thread_annotations.h"
+#include "impl/ts_unique_ptr.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace ts {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @internal
+ *
+ * @class           binary_heap
+ * @brief           The binary heap over std::vector with the unsigned indices, the replacement of
+ *                  std::priority_queue which allows moving the top element out.
+ *
+ * @tparam T        The type of the elements.
+ * @tparam TCompare The comparison function object type, the greatest element is on the top.
+ */
+template <typename T, typename TCompare>
+class binary_heap
+{
+public:
+    explicit binary_heap(const TCompare& comp)
+        : m_compare(comp)
+    {
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return m_values.empty();
+    }
+
+    [[nodiscard]] const T& top() const noexcept
+    {
+        return m_values.front();
+    }
+
+    template <typename... TArgs>
+    void emplace(TArgs&&... args)
+    {
+        m_values.emplace_back(std::forward<TArgs>(args)...);
+        std::size_t index = m_values.size() - 1;
+        while (0 != index)
+        {
+            const std::size_t parent = (index - 1) / 2;
+            if (!m_compare(m_values[parent], m_values[index]))
+            {
+                break;
+            }
+            std::swap(m_values[parent], m_values[index]);
+            index = parent;
+        }
+    }
+
+    /**
+     * @brief   Removes the top element, the heap should not be empty.
+     *
+     * @return  The removed element.
+     */
+    T pop()
+    {
+        T result { std::move(m_values.front()) };
+        if (1 != m_values.size())
+        {
+            m_values.front() = std::move(m_values.back());
+        }
+        m_values.pop_back();
+        const std::size_t size = m_values.size();
+        std::size_t index = 0;
+        while (true)
+        {
+            const std::size_t left = 2 * index + 1;
+            if (left >= size)
+            {
+                break;
+            }
+            const std::size_t right = left + 1;
+            const std::size_t child = (right < size && m_compare(m_values[left], m_values[right]))
+                    ? right
+                    : left;
+            if (!m_compare(m_values[index], m_values[child]))
+            {
+                break;
+            }
+            std::swap(m_values[index], m_values[child]);
+            index = child;
+        }
+        return result;
+    }
+
+private:
+    std::vector<T> m_values {};
+    [[no_unique_address]] TCompare m_compare;
+}; // class binary_heap
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   The ordering guarantee of ts::relaxed_priority_queue.
+ */
+enum class priority_order
+{
+    /**
+     * The queue uses several internal heaps, pop returns one of the top elements.
+     */
+    relaxed,
+
+    /**
+     * The queue uses the single internal heap, pop always returns the top element.
+     */
+    strict
+};
+
+/**
+ * @brief           ts::relaxed_priority_queue is a scalable concurrent priority queue which
+ *                  trades the strict ordering for throughput (MultiQueue).
+ *
+ * @details         The queue consists of several internal heaps, each one is guarded by its own
+ *                  ts::unique_ptr. Push inserts into a random heap which is not locked by other
+ *                  threads. Pop locks two random heaps and removes the better one of their top
+ *                  elements. With c * N heaps for N threads the popped element is expected to be
+ *                  among the top O(c * N) elements of the queue.
+ *                  In the priority_order::strict mode the queue uses the single heap, that is
+ *                  useful for tests which depend on the exact order.
+ * @example         ts::relaxed_priority_queue<int> queue;
+ *                  queue.push(13);
+ *                  if (auto val = queue.try_pop())
+ *                  {
+ *                      process(*val);
+ *                  }
+ * @tparam T        The type of the elements.
+ * @tparam TCompare The comparison function object type, as in std::priority_queue
+ *                  (optional by default std::less<T>, the greatest element is on the top).
+ * @tparam TMutex   The type of mutex of internal heaps (optional by default std::mutex).
+ */
+template <typename T, typename TCompare = std::less<T>, typename TMutex = std::mutex>
+class relaxed_priority_queue
+{
+    using t_heap = impl::binary_heap<T, TCompare>;
+    using t_heap_ptr = unique_ptr<t_heap, TMutex>;
+
+    /**
+     * The count of the heaps per thread in the relaxed mode.
+     */
+    static constexpr std::size_t s_heaps_per_thread = 2;
+
+    /**
+     * The count of attempts to find a free heap before the blocking lock.
+     */
+    static constexpr std::size_t s_try_lock_attempts = 4;
+
+    /**
+     * @internal
+     * @brief   The heap padded to the cache line to avoid false sharing between the locks.
+     */
+    struct alignas(impl::config::s_cache_line_size) heap_slot
+    {
+        t_heap_ptr m_heap {};
+    };
+
+public:
+    using value_type = T;
+    using value_compare = TCompare;
+    using size_type = std::size_t;
+    using mutex_type = TMutex;
+
+public:
+    /**
+     * @brief       Constructs the queue with the given ordering guarantee. In the relaxed mode
+     *              the count of heaps is based on the hardware concurrency.
+     *
+     * @param order The ordering guarantee.
+     * @param comp  The comparison function object.
+     */
+    explicit relaxed_priority_queue(priority_order order = priority_order::relaxed
+            , const value_compare& comp = value_compare {})
+        : relaxed_priority_queue(order == priority_order::strict
+                ? 1
+                : s_heaps_per_thread * std::max(1u, std::thread::hardware_concurrency()), comp)
+    {
+    }
+
+    /**
+     * @brief               Constructs the queue with the given count of internal heaps.
+     *                      The queue with the single heap is strict.
+     *
+     * @param heap_count    The count of heaps, should be greater than zero.
+     * @param comp          The comparison function object.
+     */
+    relaxed_priority_queue(size_type heap_count, const value_compare& comp)
+        : m_heap_count(std::max<size_type>(1, heap_count))
+        , m_heaps(std::make_unique<heap_slot[]>(m_heap_count))
+        , m_compare(comp)
+    {
+        for (size_type i = 0; i < m_heap_count; ++i)
+        {
+            m_heaps[i].m_heap.reset(new t_heap { comp });
+        }
+    }
+
+    /**
+     * Prevent copying and moving of an object.
+     */
+    relaxed_priority_queue(const relaxed_priority_queue&) = delete;
+    relaxed_priority_queue(relaxed_priority_queue&&) = delete;
+    relaxed_priority_queue& operator=(const relaxed_priority_queue&) = delete;
+    relaxed_priority_queue& operator=(relaxed_priority_queue&&) = delete;
+
+    ~relaxed_priority_queue() = default;
+
+public:
+    /**
+     * @brief       Inserts the copy of the element.
+     *
+     * @param value The value to insert.
+     */
+    void push(const value_type& value)
+    {
+        emplace(value);
+    }
+
+    /**
+     * @brief       Inserts the element using move semantic.
+     *
+     * @param value The value to insert.
+     */
+    void push(value_type&& value)
+    {
+        emplace(std::move(value));
+    }
+
+    /**
+     * @brief           Inserts a new element, constructed in-place.
+     *
+     * @tparam TArgs    The types of list of arguments with which an instance of T will be
+     *                  constructed.
+     * @param args      List of arguments with which an instance of T will be constructed.
+     */
+    template <typename... TArgs>
+    void emplace(TArgs&&... args)
+    {
+        t_heap_ptr& heap = lock_random_heap();
+        std::lock_guard lock { heap, std::adopt_lock };
+        heap.get()->emplace(std::forward<TArgs>(args)...);
+        m_size.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief   Removes one of the top elements. In the strict mode it's the top element.
+     *
+     * @return  The removed element or empty if the queue is empty.
+     */
+    std::optional<value_type> try_pop()
+    {
+        if (1 == m_heap_count)
+        {
+            std::lock_guard lock { m_heaps[0].m_heap };
+            return pop_top(*(m_heaps[0].m_heap.get()));
+        }
+
+        for (size_type attempt = 0; attempt < s_try_lock_attempts; ++attempt)
+        {
+            if (empty())
+            {
+                return std::nullopt;
+            }
+            const size_type first = impl::thread_local_random(m_heap_count);
+            size_type second = impl::thread_local_random(m_heap_count - 1);
+            second += (second >= first) ? 1 : 0;
+
+            std::unique_lock first_lock { m_heaps[first].m_heap, std::try_to_lock };
+            std::unique_lock second_lock { m_heaps[second].m_heap, std::try_to_lock };
+            t_heap* p_best = better_heap(
+                    first_lock.owns_lock() ? m_heaps[first].m_heap.get() : nullptr
+                    , second_lock.owns_lock() ? m_heaps[second].m_heap.get() : nullptr);
+            if (nullptr != p_best)
+            {
+                return pop_top(*p_best);
+            }
+        }
+
+        // The random attempts failed, scan all heaps to not miss the existing element.
+        for (size_type i = 0; i < m_heap_count && !empty(); ++i)
+        {
+            std::lock_guard lock { m_heaps[i].m_heap };
+            if (!m_heaps[i].m_heap.get()->empty())
+            {
+                return pop_top(*(m_heaps[i].m_heap.get()));
+            }
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief   Gets the count of the elements, the value may be outdated under concurrent
+     *          modifications.
+     *
+     * @return  The queue size.
+     */
+    [[nodiscard]] size_type size() const noexcept
+    {
+        return m_size.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief   Checks the queue has no elements.
+     *
+     * @return  true if the queue is empty, otherwise false.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return 0 == size();
+    }
+
+    /**
+     * @brief   Gets the count of the internal heaps.
+     *
+     * @return  The heap count.
+     */
+    [[nodiscard]] size_type heap_count() const noexcept
+    {
+        return m_heap_count;
+    }
+
+private:
+    /**
+     * @internal
+     * @brief   Locks the random heap, prefers the heaps which are not locked by other threads.
+     *
+     * @return  The locked heap.
+     */
+    t_heap_ptr& lock_random_heap() TS_NO_THREAD_SAFETY_ANALYSIS
+    {
+        for (size_type attempt = 0; attempt < s_try_lock_attempts; ++attempt)
+        {
+            t_heap_ptr& heap = m_heaps[impl::thread_local_random(m_heap_count)].m_heap;
+            if (heap.try_lock())
+            {
+                return heap;
+            }
+        }
+        t_heap_ptr& heap = m_heaps[impl::thread_local_random(m_heap_count)].m_heap;
+        heap.lock();
+        return heap;
+    }
+
+    /**
+     * @internal
+     * @brief   Chooses the non-empty heap with the better top element.
+     */
+    t_heap* better_heap(t_heap* p_first, t_heap* p_second) const
+    {
+        if (nullptr == p_first || p_first->empty())
+        {
+            return (nullptr == p_second || p_second->empty()) ? nullptr : p_second;
+        }
+        if (nullptr == p_second || p_second->empty())
+        {
+            return p_first;
+        }
+        return m_compare(p_first->top(), p_second->top()) ? p_second : p_first;
+    }
+
+    /**
+     * @internal
+     * @brief   Removes the top element of the locked heap.
+     */
+    std::optional<value_type> pop_top(t_heap& heap)
+    {
+        if (heap.empty())
+        {
+            return std::nullopt;
+        }
+        std::optional<value_type> result { heap.pop() };
+        m_size.fetch_sub(1, std::memory_order_relaxed);
+        return result;
+    }
+
+private:
+    /**
+     * The count of the internal heaps.
+     */
+    const size_type m_heap_count;
+
+    /**
+     * The internal heaps.
+     */
+    std::unique_ptr<heap_slot[]> m_heaps;
+
+    /**
+     * The approximate count of the elements.
+     */
+    alignas(impl::config::s_cache_line_size) std::atomic<size_type> m_size { 0 };
+
+    [[no_unique_address]] value_compare m_compare;
+}; // class relaxed_priority_queue
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace ts
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#endif // THREADSAFESMARTPOINTERS_TS_RELAXED_PRIORITY_QUEUE_H
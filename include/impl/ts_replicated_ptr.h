@@ -0,0 +1,376 @@
+#ifndef THREADSAFESMARTPOINTERS_TS_REPLICATED_PTR_H
+#define THREADSAFESMARTPOINTERS_TS_REPLICATED_PTR_H
+
+/**
+ * @file        ts_replicated_ptr.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of node-replicated pointer.
+ * @date        10/18/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "impl/ts_config.h"
+#include "impl/ts_mutex.h"
+#include "impl/ts_numa.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace ts {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief           ts::replicated_ptr is a smart pointer which keeps one replica of the object per
+ *                  NUMA node (node replication).
+ *
+ * @details         The modifications are appended to the shared operation log, each replica
+ *                  replays the log. The writers of the same node are flat-combined: one of them
+ *                  becomes the combiner, appends the whole batch of the node to the log by the
+ *                  single reservation and applies it to the local replica. The readers catch up
+ *                  the local replica with the log and read it under the shared lock of the
+ *                  replica, so the read-heavy object is not bounced between the sockets.
+ *                  On the single node machine there is a single replica. The modification is
+ *                  applied once per replica, so it should be deterministic.
+ * @example         ts::replicated_ptr<std::map<int, int>> map_ptr;
+ *                  map_ptr.modify([](auto& map) { map[1] = 13; });
+ *                  auto val = map_ptr.read([](const auto& map) { return map.at(1); });
+ * @warning         The modification should not throw, the exception during the replay of the
+ *                  log calls std::terminate.
+ * @tparam T        The type of the managed object.
+ * @tparam TMutex   The type of mutex of the replica (optional by default std::shared_mutex).
+ */
+template <typename T, typename TMutex = std::shared_mutex>
+class replicated_ptr
+{
+public:
+    using element_type = T;
+    using mutex_type = TMutex;
+    using operation_type = std::function<void(T&)>;
+
+    /**
+     * The replication options, by default there is one replica per NUMA node.
+     */
+    struct replication_options
+    {
+        std::size_t m_replica_count = 1;
+    };
+
+    /**
+     * The capacity of the operation log, the replica which is behind the log by the capacity
+     * is caught up by the writer.
+     */
+    static constexpr std::size_t s_log_capacity = 1024;
+
+private:
+    /**
+     * @internal
+     * @brief   The entry of the operation log, the sequence is the log index + 1 when written.
+     */
+    struct log_entry
+    {
+        operation_type m_operation {};
+        std::atomic<std::size_t> m_sequence { 0 };
+    };
+
+    /**
+     * @internal
+     * @brief   The modification published by the writer for the combiner.
+     */
+    struct pending_operation
+    {
+        operation_type m_operation;
+        std::atomic_bool m_is_done { false };
+    };
+
+    /**
+     * @internal
+     * @brief   The replica of the node, the local tail is the log index applied to the object.
+     */
+    struct alignas(impl::config::s_cache_line_size) replica
+    {
+        template <typename... TArgs>
+        explicit replica(TArgs&... args)
+            : m_object(args...)
+        {
+        }
+
+        element_type m_object;
+        TMutex m_mtx {};
+        std::atomic<std::size_t> m_local_tail { 0 };
+
+        std::mutex m_combiner_mtx {};
+        std::mutex m_batch_mtx {};
+        std::vector<pending_operation*> m_batch {};
+    };
+
+public:
+    /**
+     * @brief           Constructs one replica per NUMA node from the given arguments.
+     *
+     * @tparam TArgs    The types of list of arguments with which an instance of T will be
+     *                  constructed.
+     * @param args      List of arguments with which an instance of T will be constructed.
+     */
+    template <typename... TArgs>
+    explicit replicated_ptr(TArgs&&... args) requires(std::is_constructible_v<T, TArgs&...>)
+        : replicated_ptr(replication_options {
+                impl::numa_topology::instance().node_count() }, args...)
+    {
+    }
+
+    /**
+     * @brief           Constructs the given count of replicas from the given arguments. If the
+     *                  count is greater than the count of NUMA nodes, the replicas are shared by
+     *                  the groups of CPUs.
+     *
+     * @param options   The replication options.
+     * @param args      List of arguments with which an instance of T will be constructed.
+     */
+    template <typename... TArgs>
+    explicit replicated_ptr(replication_options options, TArgs&&... args)
+            requires(std::is_constructible_v<T, TArgs&...>)
+        : m_log(std::make_unique<log_entry[]>(s_log_capacity))
+    {
+        const std::size_t replica_count = std::max<std::size_t>(1, options.m_replica_count);
+        m_replicas.reserve(replica_count);
+        for (std::size_t i = 0; i < replica_count; ++i)
+        {
+            m_replicas.push_back(std::make_unique<replica>(args...));
+        }
+    }
+
+    /**
+     * Prevent copying and moving of an object.
+     */
+    replicated_ptr(const replicated_ptr&) = delete;
+    replicated_ptr(replicated_ptr&&) = delete;
+    replicated_ptr& operator=(const replicated_ptr&) = delete;
+    replicated_ptr& operator=(replicated_ptr&&) = delete;
+
+    ~replicated_ptr() = default;
+
+public:
+    /**
+     * @brief           Invokes the function with the const reference to the local replica, after
+     *                  catching it up with the completed modifications.
+     *
+     * @tparam TFunc    The function type, invocable with const T&.
+     * @param func      The function object.
+     * @return          The result of the function.
+     */
+    template <typename TFunc>
+    decltype(auto) read(TFunc&& func) const
+    {
+        replica& local = local_replica();
+        const std::size_t completed_tail = m_completed_tail.load(std::memory_order_acquire);
+        if (local.m_local_tail.load(std::memory_order_acquire) < completed_tail)
+        {
+            impl::t_write_lock<TMutex> lock { local.m_mtx };
+            replay(local, completed_tail);
+        }
+        impl::t_read_lock<TMutex> lock { local.m_mtx };
+        return std::invoke(std::forward<TFunc>(func), std::as_const(local.m_object));
+    }
+
+    /**
+     * @brief           Applies the modification to all replicas through the operation log.
+     *                  Returns after the modification is applied to the local replica.
+     *
+     * @tparam TFunc    The function type, invocable with T&.
+     * @param func      The function object.
+     */
+    template <typename TFunc>
+    void modify(TFunc&& func)
+    {
+        pending_operation pending { operation_type { std::forward<TFunc>(func) } };
+        replica& local = local_replica();
+        {
+            std::lock_guard lock { local.m_batch_mtx };
+            local.m_batch.push_back(&pending);
+        }
+        while (!pending.m_is_done.load(std::memory_order_acquire))
+        {
+            if (local.m_combiner_mtx.try_lock())
+            {
+                std::lock_guard lock { local.m_combiner_mtx, std::adopt_lock };
+                combine(local);
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    /**
+     * @brief   Gets the count of the replicas.
+     */
+    [[nodiscard]] std::size_t replica_count() const noexcept
+    {
+        return m_replicas.size();
+    }
+
+private:
+    /**
+     * @internal
+     * @brief   Gets the replica of the node of the current CPU.
+     */
+    replica& local_replica() const noexcept
+    {
+        const std::size_t replica_count = m_replicas.size();
+        if (1 == replica_count)
+        {
+            return *m_replicas.front();
+        }
+        const auto& topology = impl::numa_topology::instance();
+        const std::size_t cpu = topology.current_cpu();
+        const std::size_t index = (topology.node_count() >= replica_count)
+                ? topology.node_of(cpu) % replica_count
+                : cpu % replica_count;
+        return *m_replicas[index];
+    }
+
+    /**
+     * @internal
+     * @brief   Appends the batch of the node to the log and applies it to the local replica,
+     *          called by the combiner of the node.
+     */
+    void combine(replica& local)
+    {
+        std::vector<pending_operation*> batch;
+        {
+            std::lock_guard lock { local.m_batch_mtx };
+            batch.swap(local.m_batch);
+        }
+        for (std::size_t first = 0; first < batch.size(); first += s_log_capacity)
+        {
+            const std::size_t count = std::min(s_log_capacity, batch.size() - first);
+            const std::size_t start = reserve(count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                log_entry& entry = m_log[(start + i) % s_log_capacity];
+                entry.m_operation = std::move(batch[first + i]->m_operation);
+                entry.m_sequence.store(start + i + 1, std::memory_order_release);
+            }
+            {
+                impl::t_write_lock<TMutex> lock { local.m_mtx };
+                replay(local, start + count);
+            }
+            advance_completed_tail(start + count);
+        }
+        for (pending_operation* pending : batch)
+        {
+            pending->m_is_done.store(true, std::memory_order_release);
+        }
+    }
+
+    /**
+     * @internal
+     * @brief   Reserves the given count of the log entries. If the log is full, catches up the
+     *          replicas which have not applied the entries to be overwritten.
+     *
+     * @return  The log index of the first reserved entry.
+     */
+    std::size_t reserve(std::size_t count)
+    {
+        std::size_t tail = m_log_tail.load(std::memory_order_relaxed);
+        while (true)
+        {
+            if (tail + count > min_local_tail() + s_log_capacity)
+            {
+                catch_up_replicas(tail + count - s_log_capacity, tail);
+                tail = m_log_tail.load(std::memory_order_relaxed);
+            }
+            else if (m_log_tail.compare_exchange_weak(tail, tail + count
+                    , std::memory_order_acq_rel, std::memory_order_relaxed))
+            {
+                return tail;
+            }
+        }
+    }
+
+    /**
+     * @internal
+     * @brief   Replays the log up to the given tail on the replicas which are behind the given
+     *          index. The entries below the tail are reserved, so they are written soon.
+     */
+    void catch_up_replicas(std::size_t index, std::size_t tail) const
+    {
+        for (const auto& p_replica : m_replicas)
+        {
+            if (p_replica->m_local_tail.load(std::memory_order_acquire) < index)
+            {
+                impl::t_write_lock<TMutex> lock { p_replica->m_mtx };
+                replay(*p_replica, tail);
+            }
+        }
+    }
+
+    /**
+     * @internal
+     * @brief   Applies the log entries up to the given tail to the replica, the replica should be
+     *          locked exclusively.
+     */
+    void replay(replica& target, std::size_t tail) const noexcept
+    {
+        std::size_t index = target.m_local_tail.load(std::memory_order_relaxed);
+        if (index >= tail)
+        {
+            return;
+        }
+        for (; index < tail; ++index)
+        {
+            const log_entry& entry = m_log[index % s_log_capacity];
+            while (entry.m_sequence.load(std::memory_order_acquire) != index + 1)
+            {
+                std::this_thread::yield();
+            }
+            std::invoke(entry.m_operation, target.m_object);
+        }
+        target.m_local_tail.store(index, std::memory_order_release);
+    }
+
+    [[nodiscard]] std::size_t min_local_tail() const noexcept
+    {
+        std::size_t result = m_log_tail.load(std::memory_order_relaxed);
+        for (const auto& p_replica : m_replicas)
+        {
+            result = std::min(result, p_replica->m_local_tail.load(std::memory_order_acquire));
+        }
+        return result;
+    }
+
+    void advance_completed_tail(std::size_t tail) noexcept
+    {
+        std::size_t completed_tail = m_completed_tail.load(std::memory_order_relaxed);
+        while (completed_tail < tail && !m_completed_tail.compare_exchange_weak(completed_tail
+                , tail, std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
+    }
+
+private:
+    std::vector<std::unique_ptr<replica>> m_replicas;
+    std::unique_ptr<log_entry[]> m_log;
+
+    alignas(impl::config::s_cache_line_size) std::atomic<std::size_t> m_log_tail { 0 };
+    alignas(impl::config::s_cache_line_size) std::atomic<std::size_t> m_completed_tail { 0 };
+}; // class replicated_ptr
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace ts
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#endif // THREADSAFESMARTPOINTERS_TS_REPLICATED_PTR_H
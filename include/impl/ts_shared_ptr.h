@@ -10,10 +10,28 @@
  */
 
 
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <shared_mutex>
+#include <span>
+#include <stdexcept>
 #include <type_traits>
+#include <utility>
+
+#include "impl/ts_config.h"
+#include "impl/ts_file_io.h"
+#include "impl/ts_footprint.h"
+#include "impl/ts_lock_token.h"
+#include "impl/ts_mutex.h"
+#include "impl/ts_range_lock.h"
+#include "impl/ts_thread_annotations.h"
+#include "ts_null_ptr_exception.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 namespace ts {
@@ -36,35 +54,47 @@ concept is_std_shared_init_list = requires(TArgs&&... args)
 };
 
 /**
- * @brief       Checks the given type can be used as shared_mutex.
+ * @internal
+ * @brief           The deleter of the arrays created by ts::make_shared, keeps the count of the
+ *                  elements for the bound checks of the ranges.
  *
- * @tparam T    The mutex type.
+ * @tparam T        The type of the elements.
  */
 template <typename T>
-concept is_shared_lockable = requires(T mtx)
+struct array_deleter
 {
-    mtx.lock_shared();
-    mtx.unlock_shared();
-    { mtx.try_lock_shared() } -> std::same_as<bool>;
-};
+    std::size_t m_count = 0;
 
-/**
- * @brief       Gets std::shared_lock if T is shared_mutex, otherwise std::unique_lock.
- *
- * @tparam T    The mutex type.
- */
-template <typename T>
-using t_read_lock = std::conditional_t<is_shared_lockable<T>
-        , std::shared_lock<T>
-        , std::unique_lock<T>>;
+    void operator()(T* p_array) const noexcept
+    {
+        delete[] p_array;
+    }
+};
 
 /**
- * @brief       Define write lock.
+ * @internal
+ * @brief           Gets the count of the elements of the array created by ts::make_shared.
  *
- * @tparam T    The mutex type.
+ * @return          The count, or std::nullopt if the array was adopted by the raw pointer.
  */
 template <typename T>
-using t_write_lock = std::unique_lock<T>;
+std::optional<std::size_t> array_count_of(const std::shared_ptr<T>& p_data) noexcept
+{
+    using t_element_type = std::remove_cv_t<std::remove_extent_t<T>>;
+    if constexpr (config::s_track_footprint)
+    {
+        auto* p_deleter = std::get_deleter<footprint_deleter<t_footprint_key<T>>>(p_data);
+        if (nullptr != p_deleter && 0 != p_deleter->record().m_object_bytes)
+        {
+            return p_deleter->record().m_object_bytes / sizeof(t_element_type);
+        }
+    }
+    else if (const auto* p_deleter = std::get_deleter<array_deleter<t_element_type>>(p_data))
+    {
+        return p_deleter->m_count;
+    }
+    return std::nullopt;
+}
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 } // namespace impl
@@ -134,7 +164,7 @@ using t_write_lock = std::unique_lock<T>;
  * @tparam TMutex   The type of mutex (optional by default std::mutex)
  */
 template <typename T, typename TMutex = std::mutex>
-class shared_ptr
+class TS_CAPABILITY("mutex") shared_ptr
 {
     template <typename TAnyValue, typename TAnyMutex>
     friend class shared_ptr;
@@ -144,7 +174,7 @@ class shared_ptr
      */
     static constexpr bool is_read_only = std::is_const_v<T>;
 
-    using t_mutex = TMutex;
+    using t_mutex = impl::t_pointer_mutex<TMutex>;
     using t_mutex_ref = t_mutex&;
     using t_mutex_ptr = std::shared_ptr<t_mutex>;
     using t_data_ptr = std::shared_ptr<T>;
@@ -192,7 +222,7 @@ private:
          * @param mtx   The mutex reference for locking.
          * @param ptr   The object pointer for giving to a user.
          */
-        proxy_locker(t_mutex& mtx, T* ptr) noexcept
+        proxy_locker(t_mutex& mtx, T* ptr) noexcept(!impl::lock_order_may_throw<t_mutex>)
             : m_lock(mtx)
             , m_ptr(ptr)
         {
@@ -275,7 +305,8 @@ private:
          * @param mtx   The mutex reference for locking.
          * @param ptr   The object pointer for giving to a user.
          */
-        proxy_locker_for_subscript(t_mutex& mtx, element_type* ptr) noexcept
+        proxy_locker_for_subscript(t_mutex& mtx, element_type* ptr)
+                noexcept(!impl::lock_order_may_throw<t_mutex>)
             : m_lock(mtx)
             , m_ptr(ptr)
         {
@@ -350,6 +381,20 @@ public:
     {
     }
 
+    /**
+     * @brief           Constructs ts::shared_ptr from the raw pointer, the object and the control
+     *                  block are accounted in the footprint of T.
+     *
+     * @tparam U        The type of the object.
+     * @param ptr       The raw pointer.
+     */
+    template <typename U>
+    shared_ptr(U* ptr)
+            requires(impl::config::s_track_footprint && impl::is_std_shared_init_list<T, U*>)
+        : m_data { impl::make_footprint_data<T>(ptr, impl::object_bytes_of<T, U>()) }
+    {
+    }
+
     /**
      * @brief       The thread-safe move constructor for ts::shared_ptr.
      *
@@ -360,7 +405,7 @@ public:
      * @warning     If the original object is invalid, the constructor behavior is undefined.
      * @param other The reference to the original object.
      */
-    shared_ptr(shared_ptr&& other) noexcept
+    shared_ptr(shared_ptr&& other) noexcept(!impl::lock_order_may_throw<t_mutex>)
         : m_mtx {}
         , m_data {}
     {
@@ -383,7 +428,7 @@ public:
      * @param other     The reference to the original object.
      */
     template <typename TOrig> requires(!std::is_const_v<TOrig> && is_read_only)
-    shared_ptr(shared_ptr<TOrig, t_mutex>&& other) noexcept
+    shared_ptr(shared_ptr<TOrig, TMutex>&& other) noexcept(!impl::lock_order_may_throw<t_mutex>)
         : m_mtx {}
         , m_data {}
     {
@@ -421,7 +466,7 @@ public:
      * @param other     The reference to the original object.
      */
     template <typename TOrig> requires(!std::is_const_v<TOrig> && is_read_only)
-    shared_ptr(const shared_ptr<TOrig, t_mutex>& other)
+    shared_ptr(const shared_ptr<TOrig, TMutex>& other)
         : m_mtx {}
         , m_data {}
     {
@@ -442,7 +487,7 @@ public:
      * @param other The reference to the original object.
      * @return      The reference to the this object.
      */
-    shared_ptr& operator=(shared_ptr&& other) noexcept
+    shared_ptr& operator=(shared_ptr&& other) noexcept(!impl::lock_order_may_throw<t_mutex>)
     {
         if(this == std::addressof(other))
         {
@@ -450,7 +495,7 @@ public:
         }
 
         auto tmp_ref_to_mtx { this->m_mtx };
-        std::scoped_lock lock { *(tmp_ref_to_mtx.get()), *(other.m_mtx.get()) };
+        impl::ordered_lock lock { *(tmp_ref_to_mtx.get()), *(other.m_mtx.get()) };
         m_mtx = std::move(other.m_mtx);
         m_data = std::move(other.m_data);
         return *this;
@@ -468,7 +513,7 @@ public:
      * @param other The reference to the original object.
      * @return      The reference to the this object.
      */
-    shared_ptr& operator=(const shared_ptr& other) noexcept
+    shared_ptr& operator=(const shared_ptr& other) noexcept(!impl::lock_order_may_throw<t_mutex>)
     {
         if(this == std::addressof(other))
         {
@@ -476,7 +521,7 @@ public:
         }
 
         auto tmp_ref_to_mtx { this->m_mtx };
-        std::scoped_lock lock { *(tmp_ref_to_mtx.get()), other };
+        impl::ordered_lock lock { *(tmp_ref_to_mtx.get()), other };
         m_mtx = other.m_mtx;
         m_data = other.m_data;
         return *this;
@@ -501,7 +546,7 @@ public:
      *
      * @return  true if *this owns an object, false otherwise.
      */
-    explicit operator bool() const noexcept
+    explicit operator bool() const noexcept(!impl::lock_order_may_throw<t_mutex>)
     {
         impl::t_read_lock<t_mutex> lock { mutex_ref() };
         return static_cast<bool>(m_data);
@@ -510,9 +555,9 @@ public:
     /**
      * @brief   Replaces the managed object.
      */
-    void reset() noexcept
+    void reset() noexcept(!impl::lock_order_may_throw<t_mutex>)
     {
-        auto new_mutex = std::make_shared<t_mutex>();
+        auto new_mutex = make_mutex();
         std::lock_guard lock_new_mutex { *(new_mutex.get()) };
         if(nullptr == m_mtx)
         {
@@ -534,13 +579,168 @@ public:
      * @param new_pointer   Pointer to a new object to manage
      */
     template <typename... TArgs>
-    void reset(TArgs&&... new_pointer) noexcept
+    void reset(TArgs&&... new_pointer) noexcept(!impl::lock_order_may_throw<t_mutex>)
     {
-        auto new_mutex = std::make_shared<t_mutex>();
+        auto new_mutex = make_mutex();
         auto tmp_ref_to_mtx { this->m_mtx };
-        std::scoped_lock lock { *(tmp_ref_to_mtx.get()), *(new_mutex.get()) };
+        impl::ordered_lock lock { *(tmp_ref_to_mtx.get()), *(new_mutex.get()) };
         m_mtx = std::move(new_mutex);
-        m_data.reset(new_pointer...);
+        if constexpr (impl::config::s_track_footprint && 1 == sizeof...(TArgs)
+                && (std::is_pointer_v<std::remove_cvref_t<TArgs>> && ...))
+        {
+            m_data = impl::make_footprint_data<T>(new_pointer..., impl::object_bytes_of<T
+                    , std::remove_pointer_t<std::remove_cvref_t<TArgs>>...>());
+        }
+        else
+        {
+            m_data.reset(new_pointer...);
+        }
+    }
+
+    /**
+     * @brief           Invokes the function with the span of the [begin, end) range of the array
+     *                  under the range lock: the ranges of the different threads are locked
+     *                  independently, the overlapping ranges are serialized in the request order.
+     *                  The range is exclusive, or shared if the pointer is read-only.
+     *
+     * @details         The pointer mutex is held only to take the shared ownership of the array,
+     *                  the function runs under the range lock alone, so the ranges run in
+     *                  parallel with any mutex type and the array lives until the function
+     *                  returns even if the pointer is reset.
+     * @example         auto p_buffer = ts::make_shared<std::byte[]>(1 << 20);
+     *                  p_buffer.with_range(4096, 8192, [](std::span<std::byte> bytes)
+     *                  {
+     *                      std::ranges::fill(bytes, std::byte { 0 });
+     *                  });
+     * @warning         The range excludes only the other ranges, the accesses through the structure
+     *                  dereference and subscript operators and the file I/O are not excluded.
+     *                  The end is checked against the extent only for the arrays created by
+     *                  ts::make_shared.
+     * @throws          ts::null_ptr_exception if the pointer is null.
+     * @throws          std::out_of_range if begin is greater than end, or end is greater than the
+     *                  extent of the array.
+     * @param begin     The index of the first element of the range.
+     * @param end       The index after the last element of the range.
+     * @param func      The function invocable with std::span<element_type>.
+     * @return          The result of the function.
+     */
+    template <typename TFunc>
+    decltype(auto) with_range(std::size_t begin, std::size_t end, TFunc&& func) const
+            requires(std::is_array_v<T>)
+    {
+        return invoke_with_range<element_type>(begin, end, is_read_only
+                , std::forward<TFunc>(func));
+    }
+
+    /**
+     * @brief           Invokes the function with the read-only span of the [begin, end) range of
+     *                  the array under the shared range lock, the overlapping shared ranges are
+     *                  not serialized.
+     */
+    template <typename TFunc>
+    decltype(auto) with_shared_range(std::size_t begin, std::size_t end, TFunc&& func) const
+            requires(std::is_array_v<T>)
+    {
+        return invoke_with_range<const element_type>(begin, end, true
+                , std::forward<TFunc>(func));
+    }
+
+    /**
+     * @brief           Writes the [begin, end) range of the array to the file at the offset
+     *                  directly from the guarded memory, by pwritev under the read lock of the
+     *                  pointer. The range is not copied to the intermediate buffer.
+     *
+     * @example         auto p_buffer = ts::make_shared<std::byte[]>(1 << 20);
+     *                  p_buffer.write_to(fd, 0, 0, 1 << 20);
+     * @warning         The range is checked against the array length only if it's known, see
+     *                  invoke_with_range.
+     * @throws          ts::null_ptr_exception if the pointer is null.
+     * @throws          std::out_of_range if begin is greater than end, or end is greater than
+     *                  the array length.
+     * @throws          std::system_error if the write fails.
+     * @param fd        The file descriptor.
+     * @param offset    The offset in the file in bytes.
+     * @param begin     The index of the first element of the range.
+     * @param end       The index after the last element of the range.
+     * @return          The count of written bytes.
+     */
+    std::size_t write_to(int fd, std::uint64_t offset, std::size_t begin, std::size_t end) const
+            requires(impl::is_file_io_element<T>)
+    {
+        impl::t_read_lock<t_mutex> lock { mutex_ref() };
+        return impl::write_file(fd, offset
+                , std::as_bytes(impl::file_io_range(m_data.get(), begin, end
+                        , impl::array_count_of(m_data))));
+    }
+
+    /**
+     * @brief           Reads the [begin, end) range of the array from the file at the offset
+     *                  directly to the guarded memory, by preadv under the write lock of the
+     *                  pointer.
+     *
+     * @return          The count of read bytes, less than the range size at the end of the file.
+     */
+    std::size_t read_from(int fd, std::uint64_t offset, std::size_t begin, std::size_t end) const
+            requires(impl::is_file_io_element<T> && !is_read_only)
+    {
+        impl::t_write_lock<t_mutex> lock { mutex_ref() };
+        return impl::read_file(fd, offset
+                , std::as_writable_bytes(impl::file_io_range(m_data.get(), begin, end
+                        , impl::array_count_of(m_data))));
+    }
+
+    /**
+     * @brief           Submits write_to to the executor (e.g. ts::thread_pool). The task shares
+     *                  the ownership of the array and holds the lock only while the kernel
+     *                  consumes the data, the caller is not blocked at all.
+     *
+     * @return          The future of the count of written bytes.
+     */
+    template <typename TExecutor>
+    std::future<std::size_t> write_to_async(TExecutor& executor, int fd, std::uint64_t offset
+            , std::size_t begin, std::size_t end) const
+            requires(impl::is_file_io_element<T>)
+    {
+        return executor.submit([ptr = *this, fd, offset, begin, end]()
+        {
+            return ptr.write_to(fd, offset, begin, end);
+        });
+    }
+
+    /**
+     * @brief           Submits read_from to the executor (e.g. ts::thread_pool), the task shares
+     *                  the ownership of the array.
+     *
+     * @return          The future of the count of read bytes.
+     */
+    template <typename TExecutor>
+    std::future<std::size_t> read_from_async(TExecutor& executor, int fd, std::uint64_t offset
+            , std::size_t begin, std::size_t end) const
+            requires(impl::is_file_io_element<T> && !is_read_only)
+    {
+        return executor.submit([ptr = *this, fd, offset, begin, end]()
+        {
+            return ptr.read_from(fd, offset, begin, end);
+        });
+    }
+
+    /**
+     * @brief   Samples the dynamic size of the object reported by footprint_dynamic_size again,
+     *          e.g. after the container is filled. Does nothing if the footprint accounting is
+     *          disabled.
+     */
+    void update_footprint() const
+    {
+        if constexpr (impl::config::s_track_footprint)
+        {
+            impl::t_write_lock<t_mutex> lock { mutex_ref() };
+            auto* p_deleter = std::get_deleter<impl::footprint_deleter<impl::t_footprint_key<T>>>(
+                    m_data);
+            if (nullptr != p_deleter)
+            {
+                impl::update_footprint<impl::t_footprint_key<T>>(p_deleter->record(), *m_data);
+            }
+        }
     }
 
 public:
@@ -588,7 +788,7 @@ public:
      *              (void) queue.get()->pop();
      *          }
      */
-    void lock() const
+    void lock() const TS_ACQUIRE()
     {
         mutex_ref().lock();
     }
@@ -597,7 +797,7 @@ public:
      * @brief   Unlocks the mutex.
      *          Using for solve API races.
      */
-    void unlock() const
+    void unlock() const TS_RELEASE()
     {
         mutex_ref().unlock();
     }
@@ -608,7 +808,7 @@ public:
      *
      * @return  true if the lock was acquired successfully, otherwise false.
      */
-    bool try_lock() const
+    bool try_lock() const TS_TRY_ACQUIRE(true)
     {
         return mutex_ref().try_lock();
     }
@@ -622,6 +822,7 @@ public:
      *              (void) queue.get()->front();
      *          }
      */
+    TS_ACQUIRE_SHARED()
     void lock_shared() const requires(is_read_only && impl::is_shared_lockable<t_mutex>)
     {
         mutex_ref().lock_shared();
@@ -630,6 +831,7 @@ public:
     /**
      * @brief   Unlocks the mutex (shared ownership).
      */
+    TS_RELEASE_SHARED()
     void unlock_shared() const requires(is_read_only && impl::is_shared_lockable<t_mutex>)
     {
         mutex_ref().unlock_shared();
@@ -640,11 +842,85 @@ public:
      *
      * @return  true if the lock was acquired successfully, otherwise false.
      */
+    TS_TRY_ACQUIRE_SHARED(true)
     bool try_lock_shared() const requires(is_read_only && impl::is_shared_lockable<t_mutex>)
     {
         return mutex_ref().try_lock_shared();
     }
 
+    /**
+     * @brief   Checks the mutex is held by the current thread, available if the mutex is
+     *          ts::owner_aware_mutex.
+     *
+     * @return  true if the current thread holds the lock, otherwise false.
+     */
+    [[nodiscard]] bool is_locked_by_current_thread() const noexcept
+            requires(impl::is_owner_aware_lockable<t_mutex>)
+    {
+        return mutex_ref().is_locked_by_current_thread();
+    }
+
+    /**
+     * @brief   Checks there are threads waiting for the mutex, available if the mutex is
+     *          ts::contention_aware_mutex.
+     *
+     * @return  true if there are waiters, otherwise false.
+     */
+    [[nodiscard]] bool has_waiters() const noexcept
+            requires(impl::is_contention_aware_lockable<t_mutex>)
+    {
+        return mutex_ref().has_waiters();
+    }
+
+    /**
+     * @brief   Gets the number of the lock acquisitions by the waiters, available if the mutex is
+     *          ts::contention_aware_mutex.
+     *
+     * @return  The number of the handoffs.
+     */
+    [[nodiscard]] std::size_t handoff_count() const noexcept
+            requires(impl::is_contention_aware_lockable<t_mutex>)
+    {
+        return mutex_ref().handoff_count();
+    }
+
+    /**
+     * @brief   Locks the mutex and returns the token which owns the lock. The object is
+     *          accessed through the token without additional locking, the helper functions
+     *          take the token instead of the pointer.
+     *
+     * @example auto queue_token = queue.acquire();
+     *          if (!queue_token->empty())
+     *          {
+     *              queue_token->pop();
+     *          }
+     * @return  The lock token.
+     */
+    [[nodiscard]] lock_token<shared_ptr> acquire() const
+    {
+        return lock_token<shared_ptr> { *this };
+    }
+
+    /**
+     * @brief   Gets the position of the mutex in the lock hierarchy, available if the mutex is
+     *          ts::ranked_mutex. The multi-lock operations use it to lock in the rank order.
+     */
+    friend impl::lock_order_key lock_order_key_of(const shared_ptr& ptr) noexcept
+        requires(impl::is_ranked_lockable<t_mutex>)
+    {
+        return lock_order_key_of(ptr.mutex_ref());
+    }
+
+    /**
+     * @brief   Gets the diagnostic state of the mutex, available if the mutex is
+     *          ts::instrumented_mutex.
+     */
+    friend impl::mutex_diagnostics& mutex_diagnostics_of(const shared_ptr& ptr) noexcept
+        requires(impl::is_instrumented_lockable<t_mutex>)
+    {
+        return mutex_diagnostics_of(ptr.mutex_ref());
+    }
+
 private:
 
     /**
@@ -658,10 +934,81 @@ private:
         return *(m_mtx.get());
     }
 
+    template <typename TValue, typename TFunc>
+    decltype(auto) invoke_with_range(std::size_t begin, std::size_t end, bool is_shared
+            , TFunc&& func) const
+    {
+        const auto p_data = [this]()
+        {
+            impl::t_read_lock<t_mutex> lock { mutex_ref() };
+            return m_data;
+        }();
+        if (nullptr == p_data)
+        {
+            if constexpr (impl::config::s_enable_exceptions)
+            {
+                throw null_ptr_exception { "Trying to lock the range of null pointer." };
+            }
+            else
+            {
+                std::terminate();
+            }
+        }
+        if (begin > end)
+        {
+            raise_range_error("ts::shared_ptr range begin is greater than end.");
+        }
+        if (const auto count = impl::array_count_of(p_data); count.has_value() && end > *count)
+        {
+            raise_range_error("ts::shared_ptr range end is greater than the array extent.");
+        }
+        const std::span<TValue> range { p_data.get() + begin, end - begin };
+        std::optional<impl::range_guard> guard;
+        if (begin != end)
+        {
+            guard.emplace(p_data.get(), begin, end, is_shared);
+        }
+        return std::invoke(std::forward<TFunc>(func), range);
+    }
+
+    /**
+     * @internal
+     * @brief   Throws std::out_of_range, or terminates if the exceptions are disabled.
+     */
+    [[noreturn]] static void raise_range_error(const char* message)
+    {
+        if constexpr (impl::config::s_enable_exceptions)
+        {
+            throw std::out_of_range { message };
+        }
+        else
+        {
+            std::terminate();
+        }
+    }
+
+    /**
+     * @internal
+     * @brief   Allocates the mutex, the mutex and its control block are accounted in the
+     *          footprint of T.
+     */
+    static t_mutex_ptr make_mutex()
+    {
+        if constexpr (impl::config::s_track_footprint)
+        {
+            return std::allocate_shared<t_mutex>(impl::footprint_allocator<t_mutex
+                    , impl::t_footprint_key<T>, t_mutex> {});
+        }
+        else
+        {
+            return std::make_shared<t_mutex>();
+        }
+    }
+
     /**
      * The pointer to the mutex for providing object thread-safety.
      */
-    t_mutex_ptr m_mtx { std::make_shared<t_mutex>() };
+    t_mutex_ptr m_mtx { make_mutex() };
 
     /**
      * The non-thread-safe shared pointer for manage object lifetime.
@@ -699,14 +1046,24 @@ std::enable_if_t<!std::is_array<T>::value, shared_ptr<T>> make_shared(TArgs&&...
  *                      (*arr_ptr)[i] = 0;
  *                  }
  * @tparam T        The type of elements array.
+ * @tparam TMutex   The mutex type of the pointer (optional by default std::mutex).
  * @param n         The length of the array to construct.
  * @return          ts::shared_ptr of an instance of type T.
  */
-template <class T>
-std::enable_if_t<std::is_array<T>::value, shared_ptr<T>> make_shared(std::size_t n)
+template <class T, class TMutex = std::mutex>
+std::enable_if_t<std::is_array<T>::value, shared_ptr<T, TMutex>> make_shared(std::size_t n)
 {
     using t_element_type = typename std::remove_extent_t<T>;
-    return shared_ptr<T>(new t_element_type[n]);
+    if constexpr (impl::config::s_track_footprint)
+    {
+        return shared_ptr<T, TMutex>(impl::make_footprint_data<T>(new t_element_type[n]
+                , n * sizeof(t_element_type)));
+    }
+    else
+    {
+        return shared_ptr<T, TMutex>(std::shared_ptr<T>(new t_element_type[n]
+                , impl::array_deleter<t_element_type> { n }));
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -720,21 +1077,22 @@ template <typename T1, typename M1, typename T2, typename M2>
     {
         return true;
     }
-    std::scoped_lock lock { left, right };
+    impl::ordered_lock lock { left, right };
     return left.get() == right.get();
 }
 
 
 template <typename T1, typename M1, typename T2, typename M2>
 [[nodiscard]] std::strong_ordering operator<=>(const shared_ptr<T1, M1>& left
-        , const shared_ptr<T2, M2>& right) noexcept
+        , const shared_ptr<T2, M2>& right)
+        noexcept(!impl::lock_order_may_throw<M1> && !impl::lock_order_may_throw<M2>)
 {
     if (std::addressof(left) == std::addressof(right))
     {
         const auto* ptr = static_cast<typename shared_ptr<T1, M1>::element_type*>(nullptr);
         return ptr <=> ptr;
     }
-    std::scoped_lock lock { left, right };
+    impl::ordered_lock lock { left, right };
     return left.get() <=> right.get();
 }
 
@@ -750,7 +1108,7 @@ template <typename T, typename M>
 
 template <typename T, typename M>
 [[nodiscard]] std::strong_ordering operator<=>(const shared_ptr<T, M>& left
-        , std::nullptr_t) noexcept
+        , std::nullptr_t) noexcept(!impl::lock_order_may_throw<M>)
 {
     std::lock_guard lock { left };
     return left.get() <=> static_cast<typename shared_ptr<T, M>::element_type*>(nullptr);
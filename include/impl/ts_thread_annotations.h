@@ -0,0 +1,82 @@
+#ifndef THREADSAFESMARTPOINTERS_TS_THREAD_ANNOTATIONS_H
+#define THREADSAFESMARTPOINTERS_TS_THREAD_ANNOTATIONS_H
+
+/**
+ * @file        ts_thread_annotations.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration of Clang thread safety analysis attributes.
+ * @date        10/18/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+/**
+ *  The attributes are checked by Clang with -Wthread-safety, other compilers ignore them. The
+ *  attributes of the constrained member functions precede the declaration, so they don't follow
+ *  the requires clause.
+ */
+#if defined(__clang__)
+#define TS_THREAD_ANNOTATION(x) __attribute__((x))
+#else
+#define TS_THREAD_ANNOTATION(x)
+#endif
+
+/**
+ *  Marks the class as the capability (lockable object).
+ */
+#define TS_CAPABILITY(x) TS_THREAD_ANNOTATION(capability(x))
+
+/**
+ *  Marks the RAII class which holds the capability during its lifetime.
+ */
+#define TS_SCOPED_CAPABILITY TS_THREAD_ANNOTATION(scoped_lockable)
+
+/**
+ *  Marks the function which acquires the capability exclusively.
+ */
+#define TS_ACQUIRE(...) TS_THREAD_ANNOTATION(acquire_capability(__VA_ARGS__))
+
+/**
+ *  Marks the function which acquires the capability for shared ownership.
+ */
+#define TS_ACQUIRE_SHARED(...) TS_THREAD_ANNOTATION(acquire_shared_capability(__VA_ARGS__))
+
+/**
+ *  Marks the function which tries to acquire the capability exclusively, the first argument is
+ *  the return value of the successful acquisition.
+ */
+#define TS_TRY_ACQUIRE(...) TS_THREAD_ANNOTATION(try_acquire_capability(__VA_ARGS__))
+
+/**
+ *  Marks the function which tries to acquire the capability for shared ownership.
+ */
+#define TS_TRY_ACQUIRE_SHARED(...) \
+        TS_THREAD_ANNOTATION(try_acquire_shared_capability(__VA_ARGS__))
+
+/**
+ *  Marks the function which releases the capability.
+ */
+#define TS_RELEASE(...) TS_THREAD_ANNOTATION(release_capability(__VA_ARGS__))
+
+/**
+ *  Marks the function which releases the shared ownership of the capability.
+ */
+#define TS_RELEASE_SHARED(...) TS_THREAD_ANNOTATION(release_shared_capability(__VA_ARGS__))
+
+/**
+ *  Marks the function which requires the capability to be held by the caller.
+ */
+#define TS_REQUIRES(...) TS_THREAD_ANNOTATION(requires_capability(__VA_ARGS__))
+
+/**
+ *  Marks the function which requires the capability to be held by the caller for shared
+ *  ownership at least.
+ */
+#define TS_REQUIRES_SHARED(...) TS_THREAD_ANNOTATION(requires_shared_capability(__VA_ARGS__))
+
+/**
+ *  Disables the analysis for the function which implements the locking itself.
+ */
+#define TS_NO_THREAD_SAFETY_ANALYSIS TS_THREAD_ANNOTATION(no_thread_safety_analysis)
+
+
+#endif // THREADSAFESMARTPOINTERS_TS_THREAD_ANNOTATIONS_H
@@ -0,0 +1,517 @@
+#ifndef THREADSAFESMARTPOINTERS_TS_THREAD_POOL_H
+#define THREADSAFESMARTPOINTERS_TS_THREAD_POOL_H
+
+/**
+ * @file        ts_thread_pool.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of work-stealing thread pool.
+ * @date        10/18/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "impl/ts_config.h"
+#include "impl/ts_random.h"
+#include "impl/ts_thread_annotations.h"
+#include "impl/ts_work_stealing_deque.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace ts {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief       Checks the given type can be locked without blocking, like ts::shared_ptr,
+ *              ts::unique_ptr or any mutex.
+ *
+ * @tparam T    The lockable type.
+ */
+template <typename T>
+concept is_try_lockable = requires(T& lockable)
+{
+    { lockable.try_lock() } -> std::convertible_to<bool>;
+    lockable.unlock();
+};
+
+/**
+ * @internal
+ * @brief   The result of the task execution.
+ */
+enum class task_status
+{
+    completed,
+    retry
+};
+
+/**
+ * @internal
+ * @brief   The base of type-erased pool tasks.
+ */
+class pool_task
+{
+public:
+    pool_task() = default;
+    virtual ~pool_task() = default;
+
+    pool_task(const pool_task&) = delete;
+    pool_task(pool_task&&) = delete;
+    pool_task& operator=(const pool_task&) = delete;
+    pool_task& operator=(pool_task&&) = delete;
+
+    /**
+     * @brief   Executes the task.
+     *
+     * @return  task_status::retry if the task could not run now and should be re-queued.
+     */
+    virtual task_status run() = 0;
+};
+
+/**
+ * @internal
+ * @brief       The task which executes the function object.
+ *
+ * @tparam TFunc The function object type.
+ */
+template <typename TFunc>
+class function_task final : public pool_task
+{
+public:
+    explicit function_task(TFunc func)
+        : m_func(std::move(func))
+    {
+    }
+
+    task_status run() override
+    {
+        m_func();
+        return task_status::completed;
+    }
+
+private:
+    TFunc m_func;
+};
+
+/**
+ * @internal
+ * @brief           The task which executes the function object under the lock of the given
+ *                  lockable object. If the lockable is busy the task asks to be re-queued
+ *                  instead of blocking the worker.
+ *
+ * @tparam TLockable The lockable type.
+ * @tparam TFunc    The function object type.
+ */
+template <typename TLockable, typename TFunc>
+class locked_task final : public pool_task
+{
+public:
+    locked_task(TLockable& lockable, TFunc func)
+        : m_lockable(lockable)
+        , m_func(std::move(func))
+    {
+    }
+
+    task_status run() override TS_NO_THREAD_SAFETY_ANALYSIS
+    {
+        if (!m_lockable.try_lock())
+        {
+            return task_status::retry;
+        }
+        std::lock_guard lock { m_lockable, std::adopt_lock };
+        m_func();
+        return task_status::completed;
+    }
+
+private:
+    TLockable& m_lockable;
+    TFunc m_func;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief           ts::thread_pool is a work-stealing thread pool for bulk and asynchronous
+ *                  operations on the guarded objects.
+ *
+ * @details         Every worker owns the Chase-Lev deque. The tasks submitted from a worker
+ *                  are pushed to its own deque, the tasks submitted from other threads are
+ *                  pushed to the shared injection queue. The idle worker takes the tasks from
+ *                  its own deque first, then from the injection queue, then steals from other
+ *                  workers. The workers sleep when there is no work.
+ *                  The tasks submitted with submit_locked run under the lock of the given
+ *                  ts::shared_ptr, ts::unique_ptr or other lockable object. If the lock is
+ *                  busy, the task is re-queued and the worker takes the other work instead of
+ *                  blocking.
+ * @example         ts::thread_pool pool;
+ *                  auto future = pool.submit([](int a, int b) { return a + b; }, 1, 2);
+ *                  auto arr_ptr = ts::make_shared<int32_t[]>(element_count);
+ *                  pool.parallel_for(0, element_count, 1024, [&arr_ptr](int32_t i)
+ *                  {
+ *                      (*arr_ptr)[i] = i;
+ *                  });
+ *                  auto queue = ts::make_shared<std::queue<int32_t>>();
+ *                  pool.submit_locked(queue, [&queue]() { queue.get()->push(13); });
+ * @warning         The destructor waits for all submitted tasks. The task should not block on
+ *                  the future of other task of the same pool, use parallel_for which executes
+ *                  the pending tasks while waiting.
+ */
+class thread_pool
+{
+    using t_task_ptr = impl::pool_task*;
+    using t_deque = impl::work_stealing_deque<impl::pool_task>;
+
+    /**
+     * @internal
+     * @brief   The worker of the pool, padded to the cache line.
+     */
+    struct alignas(impl::config::s_cache_line_size) worker
+    {
+        t_deque m_deque {};
+        std::thread m_thread {};
+    };
+
+    /**
+     * @internal
+     * @brief   Identifies the pool and the worker of the current thread.
+     */
+    struct worker_identity
+    {
+        const thread_pool* m_pool = nullptr;
+        std::size_t m_index = 0;
+    };
+
+public:
+    /**
+     * @brief               Constructs the pool and starts the workers.
+     *
+     * @param thread_count  The count of the workers (optional by default the hardware
+     *                      concurrency).
+     */
+    explicit thread_pool(std::size_t thread_count = std::max(1u
+            , std::thread::hardware_concurrency()))
+        : m_worker_count(std::max<std::size_t>(1, thread_count))
+        , m_workers(std::make_unique<worker[]>(m_worker_count))
+    {
+        for (std::size_t i = 0; i < m_worker_count; ++i)
+        {
+            m_workers[i].m_thread = std::thread { [this, i]() { worker_loop(i); } };
+        }
+    }
+
+    /**
+     * @brief   Waits for all submitted tasks and stops the workers.
+     */
+    ~thread_pool()
+    {
+        {
+            std::lock_guard lock { m_mtx };
+            m_stop = true;
+        }
+        m_wake_up.notify_all();
+        for (std::size_t i = 0; i < m_worker_count; ++i)
+        {
+            m_workers[i].m_thread.join();
+        }
+    }
+
+    /**
+     * Prevent copying and moving of an object.
+     */
+    thread_pool(const thread_pool&) = delete;
+    thread_pool(thread_pool&&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+    thread_pool& operator=(thread_pool&&) = delete;
+
+public:
+    /**
+     * @brief           Submits the function for the asynchronous execution.
+     *
+     * @tparam TFunc    The function type.
+     * @tparam TArgs    The argument types.
+     * @param func      The function object.
+     * @param args      The arguments of the function.
+     * @return          The future of the function result.
+     */
+    template <typename TFunc, typename... TArgs>
+    auto submit(TFunc&& func, TArgs&&... args)
+        -> std::future<std::invoke_result_t<std::decay_t<TFunc>, std::decay_t<TArgs>...>>
+    {
+        using t_result = std::invoke_result_t<std::decay_t<TFunc>, std::decay_t<TArgs>...>;
+        std::packaged_task<t_result()> task {
+            [func = std::forward<TFunc>(func), ... args = std::forward<TArgs>(args)]() mutable
+            {
+                return std::invoke(std::move(func), std::move(args)...);
+            } };
+        auto future = task.get_future();
+        schedule(new impl::function_task { std::move(task) });
+        return future;
+    }
+
+    /**
+     * @brief           Submits the function which will be executed under the lock of the given
+     *                  lockable object (ts::shared_ptr, ts::unique_ptr, mutex). If the lockable
+     *                  object is locked by other thread, the task is re-queued and the worker
+     *                  takes the other work instead of blocking.
+     *
+     * @warning         The lockable object should outlive the task.
+     * @tparam TLockable The lockable type.
+     * @tparam TFunc    The function type, invocable without arguments.
+     * @param lockable  The lockable object.
+     * @param func      The function object.
+     * @return          The future of the function result.
+     */
+    template <impl::is_try_lockable TLockable, typename TFunc>
+    auto submit_locked(TLockable& lockable, TFunc&& func)
+        -> std::future<std::invoke_result_t<std::decay_t<TFunc>>>
+    {
+        using t_result = std::invoke_result_t<std::decay_t<TFunc>>;
+        std::packaged_task<t_result()> task { std::forward<TFunc>(func) };
+        auto future = task.get_future();
+        schedule(new impl::locked_task<TLockable, std::packaged_task<t_result()>> {
+                lockable, std::move(task) });
+        return future;
+    }
+
+    /**
+     * @brief           Executes the function for each index in the range [first, last) in
+     *                  parallel. The range is split into chunks of the grain size, the calling
+     *                  thread participates in the execution until all chunks are done.
+     *
+     * @throws          The first exception thrown by the function.
+     * @tparam TIndex   The index type.
+     * @tparam TFunc    The function type, invocable with TIndex.
+     * @param first     The first index.
+     * @param last      The index after the last one.
+     * @param grain     The count of indexes processed by single task.
+     * @param func      The function object.
+     */
+    template <typename TIndex, typename TFunc>
+    void parallel_for(TIndex first, TIndex last, TIndex grain, TFunc&& func)
+    {
+        if (!(first < last))
+        {
+            return;
+        }
+        grain = std::max<TIndex>(grain, TIndex { 1 });
+        const auto chunk_count
+                = static_cast<std::size_t>((last - first + grain - TIndex { 1 }) / grain);
+
+        std::atomic<std::size_t> remaining { chunk_count };
+        std::exception_ptr p_error {};
+        std::mutex error_mtx {};
+
+        for (TIndex chunk_begin = first; chunk_begin < last; )
+        {
+            const TIndex chunk_end = (last - chunk_begin > grain) ? chunk_begin + grain : last;
+            auto chunk = [&func, &remaining, &p_error, &error_mtx, chunk_begin, chunk_end]()
+            {
+                try
+                {
+                    for (TIndex i = chunk_begin; i < chunk_end; ++i)
+                    {
+                        func(i);
+                    }
+                }
+                catch (...)
+                {
+                    std::lock_guard lock { error_mtx };
+                    if (nullptr == p_error)
+                    {
+                        p_error = std::current_exception();
+                    }
+                }
+                remaining.fetch_sub(1, std::memory_order_acq_rel);
+            };
+            schedule(new impl::function_task { std::move(chunk) });
+            chunk_begin = chunk_end;
+        }
+
+        while (0 != remaining.load(std::memory_order_acquire))
+        {
+            if (!run_pending_task())
+            {
+                std::this_thread::yield();
+            }
+        }
+        if (nullptr != p_error)
+        {
+            std::rethrow_exception(p_error);
+        }
+    }
+
+    /**
+     * @brief   Gets the count of the workers.
+     *
+     * @return  The worker count.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return m_worker_count;
+    }
+
+private:
+    /**
+     * @internal
+     * @brief   Pushes the task to the deque of the current worker or to the injection queue.
+     */
+    void schedule(t_task_ptr p_task)
+    {
+        const worker_identity& identity = current_worker();
+        m_pending.fetch_add(1, std::memory_order_seq_cst);
+        if (this == identity.m_pool)
+        {
+            m_workers[identity.m_index].m_deque.push(p_task);
+        }
+        else
+        {
+            std::lock_guard lock { m_mtx };
+            m_injected.push_back(p_task);
+        }
+        if (0 != m_idle.load(std::memory_order_seq_cst))
+        {
+            std::lock_guard lock { m_mtx };
+            m_wake_up.notify_one();
+        }
+    }
+
+    /**
+     * @internal
+     * @brief   Takes the task from the own deque, the injection queue or steals it.
+     */
+    t_task_ptr take_task()
+    {
+        const worker_identity& identity = current_worker();
+        const bool is_worker = (this == identity.m_pool);
+        t_task_ptr p_task = nullptr;
+        if (is_worker)
+        {
+            p_task = m_workers[identity.m_index].m_deque.pop();
+        }
+        if (nullptr == p_task)
+        {
+            std::lock_guard lock { m_mtx };
+            if (!m_injected.empty())
+            {
+                p_task = m_injected.front();
+                m_injected.pop_front();
+            }
+        }
+        if (nullptr == p_task)
+        {
+            const std::size_t start = impl::thread_local_random(m_worker_count);
+            for (std::size_t i = 0; i < m_worker_count && nullptr == p_task; ++i)
+            {
+                const std::size_t victim = (start + i) % m_worker_count;
+                if (!is_worker || victim != identity.m_index)
+                {
+                    p_task = m_workers[victim].m_deque.steal();
+                }
+            }
+        }
+        if (nullptr != p_task)
+        {
+            m_pending.fetch_sub(1, std::memory_order_seq_cst);
+        }
+        return p_task;
+    }
+
+    /**
+     * @internal
+     * @brief   Runs the single pending task, re-queues the task which asked to retry.
+     *
+     * @return  true if the task was taken, otherwise false.
+     */
+    bool run_pending_task()
+    {
+        t_task_ptr p_task = take_task();
+        if (nullptr == p_task)
+        {
+            return false;
+        }
+        if (impl::task_status::retry == p_task->run())
+        {
+            m_pending.fetch_add(1, std::memory_order_seq_cst);
+            {
+                std::lock_guard lock { m_mtx };
+                m_injected.push_back(p_task);
+            }
+            std::this_thread::yield();
+            return true;
+        }
+        delete p_task;
+        return true;
+    }
+
+    void worker_loop(std::size_t index)
+    {
+        current_worker() = worker_identity { this, index };
+        while (true)
+        {
+            if (run_pending_task())
+            {
+                continue;
+            }
+            std::unique_lock lock { m_mtx };
+            m_idle.fetch_add(1, std::memory_order_seq_cst);
+            m_wake_up.wait(lock, [this]()
+            {
+                return m_stop || 0 != m_pending.load(std::memory_order_seq_cst);
+            });
+            m_idle.fetch_sub(1, std::memory_order_seq_cst);
+            if (m_stop && 0 == m_pending.load(std::memory_order_seq_cst))
+            {
+                return;
+            }
+        }
+    }
+
+    static worker_identity& current_worker() noexcept
+    {
+        static thread_local worker_identity s_identity {};
+        return s_identity;
+    }
+
+private:
+    const std::size_t m_worker_count;
+    std::unique_ptr<worker[]> m_workers;
+
+    /**
+     * The queue for the tasks submitted from non-worker threads and the re-queued tasks.
+     */
+    std::mutex m_mtx {};
+    std::deque<t_task_ptr> m_injected {};
+    std::condition_variable m_wake_up {};
+    bool m_stop = false;
+
+    /**
+     * The count of queued tasks and sleeping workers.
+     */
+    alignas(impl::config::s_cache_line_size) std::atomic<std::size_t> m_pending { 0 };
+    std::atomic<std::size_t> m_idle { 0 };
+}; // class thread_pool
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace ts
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#endif // THREADSAFESMARTPOINTERS_TS_THREAD_POOL_H
@@ -0,0 +1,615 @@
+#ifndef THREADSAFESMARTPOINTERS_TS_TILED_ARRAY_H
+#define THREADSAFESMARTPOINTERS_TS_TILED_ARRAY_H
+
+/**
+ * @file        ts_tiled_array.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of N-dimensional array with per-tile locks.
+ * @date        10/18/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <shared_mutex>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "impl/ts_config.h"
+#include "impl/ts_mutex.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace ts {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief           ts::tiled_array is an N-dimensional array partitioned into the tiles, each
+ *                  tile is guarded by its own mutex.
+ *
+ * @details         The elements of the tile are stored contiguously (row-major inside the tile,
+ *                  the tiles are row-major in the grid of tiles), so the kernel of the tile walks
+ *                  the contiguous memory and can be vectorized. The edge tiles have the full size,
+ *                  their elements outside the array are the padding. The mutexes are padded to
+ *                  the cache line. The region locks the overlapped tiles in the ascending order
+ *                  of the tile index, so the concurrent regions never deadlock and the disjoint
+ *                  regions are processed fully in parallel.
+ * @example         ts::tiled_array<float, 2> grid { { 1024, 1024 } };
+ *                  grid.with_tile(0, 1, [](auto tile) { std::ranges::fill(tile.data(), 1.0f); });
+ *                  grid.with_region({ { 10, 10 }, { 20, 20 } }, [](auto region)
+ *                  {
+ *                      region(15, 15) = region(14, 15) + region(16, 15);
+ *                  });
+ * @tparam T        The type of the elements, should be default constructible.
+ * @tparam Rank     The count of dimensions.
+ * @tparam TMutex   The type of the mutex of the tile (optional by default std::shared_mutex).
+ */
+template <typename T, std::size_t Rank, typename TMutex = std::shared_mutex>
+class tiled_array
+{
+    static_assert(Rank > 0, "ts::tiled_array should have at least one dimension.");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using mutex_type = TMutex;
+
+    /**
+     * The N-dimensional index or extents.
+     */
+    using index_type = std::array<size_type, Rank>;
+
+    /**
+     * @brief   The rectangular region of the array, the last index is exclusive.
+     */
+    struct region
+    {
+        index_type m_first {};
+        index_type m_last {};
+    };
+
+    /**
+     * The default size of the tile in bytes.
+     */
+    static constexpr size_type s_default_tile_bytes = 4096;
+
+private:
+    /**
+     * @internal
+     * @brief   The mutex of the tile, padded to the cache line.
+     */
+    struct alignas(impl::config::s_cache_line_size) tile_mutex
+    {
+        mutable TMutex m_mtx {};
+    };
+
+public:
+    /**
+     * @brief           The view to the locked tile.
+     *
+     * @tparam TValue   T or const T.
+     */
+    template <typename TValue>
+    class basic_tile_view
+    {
+    public:
+        basic_tile_view(std::span<TValue> data, const index_type& origin
+                , const index_type& extents, const index_type& tile_extents) noexcept
+            : m_data(data)
+            , m_origin(origin)
+            , m_extents(extents)
+            , m_tile_extents(tile_extents)
+        {
+        }
+
+        /**
+         * @brief   Gets the contiguous storage of the tile, including the padding of the edge
+         *          tile.
+         */
+        [[nodiscard]] std::span<TValue> data() const noexcept
+        {
+            return m_data;
+        }
+
+        /**
+         * @brief   Gets the index of the first element of the tile in the array.
+         */
+        [[nodiscard]] const index_type& origin() const noexcept
+        {
+            return m_origin;
+        }
+
+        /**
+         * @brief   Gets the extents of the tile inside the array, less than the tile extents for
+         *          the edge tile.
+         */
+        [[nodiscard]] const index_type& extents() const noexcept
+        {
+            return m_extents;
+        }
+
+        /**
+         * @brief   Gets the extents of the tile storage, the strides of data() are derived from.
+         */
+        [[nodiscard]] const index_type& tile_extents() const noexcept
+        {
+            return m_tile_extents;
+        }
+
+        /**
+         * @brief   Gets the element by the index local to the tile.
+         */
+        TValue& operator[](const index_type& local) const noexcept
+        {
+            return m_data[tiled_array::local_offset(local, m_tile_extents)];
+        }
+
+        template <typename... TIndexes>
+        TValue& operator()(TIndexes... local) const noexcept
+                requires(sizeof...(TIndexes) == Rank && (std::integral<TIndexes> && ...))
+        {
+            return (*this)[index_type { static_cast<size_type>(local)... }];
+        }
+
+    private:
+        std::span<TValue> m_data;
+        index_type m_origin;
+        index_type m_extents;
+        index_type m_tile_extents;
+    }; // class basic_tile_view
+
+    /**
+     * @brief           The view to the locked region, the elements are accessed by the index of
+     *                  the array.
+     *
+     * @tparam TValue   T or const T.
+     */
+    template <typename TValue>
+    class basic_region_view
+    {
+        using t_array = std::conditional_t<std::is_const_v<TValue>, const tiled_array
+                , tiled_array>;
+
+    public:
+        basic_region_view(t_array& array, const region& bounds) noexcept
+            : m_array(array)
+            , m_bounds(bounds)
+        {
+        }
+
+        [[nodiscard]] const region& bounds() const noexcept
+        {
+            return m_bounds;
+        }
+
+        /**
+         * @brief   Gets the element by the index of the array, the index should be inside the
+         *          region.
+         */
+        TValue& operator[](const index_type& index) const noexcept
+        {
+            assert(contains(index) && "ts::tiled_array index is outside the locked region.");
+            return m_array.m_data[m_array.offset_of(index)];
+        }
+
+        template <typename... TIndexes>
+        TValue& operator()(TIndexes... index) const noexcept
+                requires(sizeof...(TIndexes) == Rank && (std::integral<TIndexes> && ...))
+        {
+            return (*this)[index_type { static_cast<size_type>(index)... }];
+        }
+
+    private:
+        [[nodiscard]] bool contains(const index_type& index) const noexcept
+        {
+            for (size_type dim = 0; dim < Rank; ++dim)
+            {
+                if (index[dim] < m_bounds.m_first[dim] || index[dim] >= m_bounds.m_last[dim])
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+    private:
+        t_array& m_array;
+        region m_bounds;
+    }; // class basic_region_view
+
+    using tile_view = basic_tile_view<T>;
+    using const_tile_view = basic_tile_view<const T>;
+    using region_view = basic_region_view<T>;
+    using const_region_view = basic_region_view<const T>;
+
+public:
+    /**
+     * @brief               Constructs the array of the value-initialized elements.
+     *
+     * @param extents       The extents of the array.
+     * @param tile_extents  The extents of the tile, by default the tile is the hypercube of
+     *                      about s_default_tile_bytes.
+     */
+    explicit tiled_array(const index_type& extents, const index_type& tile_extents
+            = default_tile_extents())
+        : m_extents(extents)
+        , m_tile_extents(tile_extents)
+    {
+        size_type tile_count = 1;
+        m_tile_volume = 1;
+        for (size_type dim = 0; dim < Rank; ++dim)
+        {
+            if (0 == m_tile_extents[dim])
+            {
+                raise_error<std::invalid_argument>("ts::tiled_array tile extent should not be 0.");
+            }
+            m_tile_grid[dim] = (m_extents[dim] + m_tile_extents[dim] - 1) / m_tile_extents[dim];
+            tile_count *= m_tile_grid[dim];
+            m_tile_volume *= m_tile_extents[dim];
+        }
+        m_tile_count = tile_count;
+        m_data = std::make_unique<T[]>(m_tile_count * m_tile_volume);
+        m_mutexes = std::make_unique<tile_mutex[]>(m_tile_count);
+    }
+
+    /**
+     * Prevent copying and moving of an object.
+     */
+    tiled_array(const tiled_array&) = delete;
+    tiled_array(tiled_array&&) = delete;
+    tiled_array& operator=(const tiled_array&) = delete;
+    tiled_array& operator=(tiled_array&&) = delete;
+
+    ~tiled_array() = default;
+
+public:
+    /**
+     * @brief           Invokes the function with the view to the tile under the exclusive lock of
+     *                  the tile.
+     *
+     * @example         grid.with_tile(1, 2, [](auto tile) { kernel(tile.data()); });
+     * @param args      The N-dimensional index of the tile in the grid of tiles, followed by the
+     *                  function invocable with tile_view.
+     * @throws          std::out_of_range if the tile is outside the grid.
+     * @return          The result of the function.
+     */
+    template <typename... TArgs>
+    decltype(auto) with_tile(TArgs&&... args) requires(sizeof...(TArgs) == Rank + 1)
+    {
+        return invoke_with_tile(*this, std::forward_as_tuple(std::forward<TArgs>(args)...)
+                , std::make_index_sequence<Rank> {});
+    }
+
+    /**
+     * @brief           Invokes the function with the read-only view to the tile under the shared
+     *                  lock of the tile.
+     */
+    template <typename... TArgs>
+    decltype(auto) with_tile(TArgs&&... args) const requires(sizeof...(TArgs) == Rank + 1)
+    {
+        return invoke_with_tile(*this, std::forward_as_tuple(std::forward<TArgs>(args)...)
+                , std::make_index_sequence<Rank> {});
+    }
+
+    /**
+     * @brief           Invokes the function with the view to the region under the exclusive locks
+     *                  of all overlapped tiles, locked in the ascending order of the tile index.
+     *
+     * @param bounds    The region, should be inside the array.
+     * @param func      The function invocable with region_view.
+     * @throws          std::out_of_range if the region is outside the array.
+     * @return          The result of the function.
+     */
+    template <typename TFunc>
+    decltype(auto) with_region(const region& bounds, TFunc&& func)
+    {
+        region_lock<false> lock { *this, bounds };
+        return std::invoke(std::forward<TFunc>(func), region_view { *this, bounds });
+    }
+
+    /**
+     * @brief           Invokes the function with the read-only view to the region under the
+     *                  shared locks of all overlapped tiles.
+     */
+    template <typename TFunc>
+    decltype(auto) with_region(const region& bounds, TFunc&& func) const
+    {
+        region_lock<true> lock { *this, bounds };
+        return std::invoke(std::forward<TFunc>(func), const_region_view { *this, bounds });
+    }
+
+    [[nodiscard]] const index_type& extents() const noexcept
+    {
+        return m_extents;
+    }
+
+    [[nodiscard]] const index_type& tile_extents() const noexcept
+    {
+        return m_tile_extents;
+    }
+
+    /**
+     * @brief   Gets the extents of the grid of tiles.
+     */
+    [[nodiscard]] const index_type& tile_grid() const noexcept
+    {
+        return m_tile_grid;
+    }
+
+    [[nodiscard]] size_type tile_count() const noexcept
+    {
+        return m_tile_count;
+    }
+
+    /**
+     * @brief   Gets the index of the tile which contains the element.
+     */
+    [[nodiscard]] index_type tile_of(const index_type& index) const noexcept
+    {
+        index_type tile {};
+        for (size_type dim = 0; dim < Rank; ++dim)
+        {
+            tile[dim] = index[dim] / m_tile_extents[dim];
+        }
+        return tile;
+    }
+
+private:
+    /**
+     * @internal
+     * @brief   The locks of the tiles overlapped by the region, the tiles are locked in the
+     *          ascending order of the tile index and unlocked in the reverse order.
+     */
+    template <bool IsShared>
+    class region_lock
+    {
+    public:
+        region_lock(const tiled_array& array, const region& bounds)
+            : m_array(array)
+        {
+            index_type first_tile {};
+            index_type last_tile {};
+            for (size_type dim = 0; dim < Rank; ++dim)
+            {
+                if (bounds.m_first[dim] >= bounds.m_last[dim]
+                        || bounds.m_last[dim] > array.m_extents[dim])
+                {
+                    raise_error<std::out_of_range>("ts::tiled_array region is out of range.");
+                }
+                first_tile[dim] = bounds.m_first[dim] / array.m_tile_extents[dim];
+                last_tile[dim] = (bounds.m_last[dim] - 1) / array.m_tile_extents[dim] + 1;
+            }
+            m_first_tile = first_tile;
+            m_last_tile = last_tile;
+            size_type locked_count = 0;
+            try
+            {
+                for_each_tile([this, &locked_count](size_type tile)
+                {
+                    lock_tile(tile);
+                    ++locked_count;
+                });
+            }
+            catch (...)
+            {
+                // The destructor isn't called, the already locked tiles are unlocked here.
+                for_each_tile([this, &locked_count](size_type tile)
+                {
+                    if (0 != locked_count)
+                    {
+                        --locked_count;
+                        unlock_tile(tile);
+                    }
+                });
+                throw;
+            }
+        }
+
+        ~region_lock()
+        {
+            for_each_tile([this](size_type tile) { unlock_tile(tile); });
+        }
+
+        region_lock(const region_lock&) = delete;
+        region_lock(region_lock&&) = delete;
+        region_lock& operator=(const region_lock&) = delete;
+        region_lock& operator=(region_lock&&) = delete;
+
+    private:
+        /**
+         * @internal
+         * @brief   Visits the tiles of the region in the row-major (ascending index) order.
+         */
+        template <typename TVisitor>
+        void for_each_tile(TVisitor&& visitor) const
+        {
+            index_type tile = m_first_tile;
+            while (true)
+            {
+                visitor(m_array.tile_index(tile));
+                size_type dim = Rank;
+                while (dim > 0)
+                {
+                    --dim;
+                    if (++tile[dim] < m_last_tile[dim])
+                    {
+                        break;
+                    }
+                    tile[dim] = m_first_tile[dim];
+                    if (0 == dim)
+                    {
+                        return;
+                    }
+                }
+            }
+        }
+
+        void lock_tile(size_type tile) const
+        {
+            TMutex& mtx = m_array.m_mutexes[tile].m_mtx;
+            if constexpr (IsShared && impl::is_shared_lockable<TMutex>)
+            {
+                mtx.lock_shared();
+            }
+            else
+            {
+                mtx.lock();
+            }
+        }
+
+        void unlock_tile(size_type tile) const noexcept
+        {
+            TMutex& mtx = m_array.m_mutexes[tile].m_mtx;
+            if constexpr (IsShared && impl::is_shared_lockable<TMutex>)
+            {
+                mtx.unlock_shared();
+            }
+            else
+            {
+                mtx.unlock();
+            }
+        }
+
+    private:
+        const tiled_array& m_array;
+        index_type m_first_tile {};
+        index_type m_last_tile {};
+    }; // class region_lock
+
+    template <typename TArray, typename TTuple, std::size_t... Is>
+    static decltype(auto) invoke_with_tile(TArray& array, TTuple&& args
+            , std::index_sequence<Is...>)
+    {
+        using t_value = std::conditional_t<std::is_const_v<TArray>, const T, T>;
+        using t_lock = std::conditional_t<std::is_const_v<TArray>, impl::t_read_lock<TMutex>
+                , impl::t_write_lock<TMutex>>;
+
+        const index_type tile { static_cast<size_type>(std::get<Is>(args))... };
+        index_type origin {};
+        index_type extents {};
+        for (size_type dim = 0; dim < Rank; ++dim)
+        {
+            if (tile[dim] >= array.m_tile_grid[dim])
+            {
+                raise_error<std::out_of_range>("ts::tiled_array tile is out of range.");
+            }
+            origin[dim] = tile[dim] * array.m_tile_extents[dim];
+            extents[dim] = std::min(array.m_tile_extents[dim], array.m_extents[dim] - origin[dim]);
+        }
+
+        const size_type index = array.tile_index(tile);
+        t_lock lock { array.m_mutexes[index].m_mtx };
+        basic_tile_view<t_value> view { std::span<t_value> { array.m_data.get()
+                + index * array.m_tile_volume, array.m_tile_volume }, origin, extents
+                , array.m_tile_extents };
+        return std::invoke(std::get<Rank>(std::forward<TTuple>(args)), view);
+    }
+
+    /**
+     * @internal
+     * @brief   Throws the exception, or terminates if the exceptions are disabled.
+     */
+    template <typename TException>
+    [[noreturn]] static void raise_error(const char* message)
+    {
+        if constexpr (impl::config::s_enable_exceptions)
+        {
+            throw TException { message };
+        }
+        else
+        {
+            std::terminate();
+        }
+    }
+
+    /**
+     * @internal
+     * @brief   Gets the row-major index of the tile in the grid of tiles.
+     */
+    [[nodiscard]] size_type tile_index(const index_type& tile) const noexcept
+    {
+        size_type index = 0;
+        for (size_type dim = 0; dim < Rank; ++dim)
+        {
+            index = index * m_tile_grid[dim] + tile[dim];
+        }
+        return index;
+    }
+
+    static size_type local_offset(const index_type& local, const index_type& tile_extents) noexcept
+    {
+        size_type offset = 0;
+        for (size_type dim = 0; dim < Rank; ++dim)
+        {
+            offset = offset * tile_extents[dim] + local[dim];
+        }
+        return offset;
+    }
+
+    /**
+     * @internal
+     * @brief   Gets the offset of the element in the tile-contiguous storage.
+     */
+    [[nodiscard]] size_type offset_of(const index_type& index) const noexcept
+    {
+        index_type tile {};
+        index_type local {};
+        for (size_type dim = 0; dim < Rank; ++dim)
+        {
+            tile[dim] = index[dim] / m_tile_extents[dim];
+            local[dim] = index[dim] % m_tile_extents[dim];
+        }
+        return tile_index(tile) * m_tile_volume + local_offset(local, m_tile_extents);
+    }
+
+    /**
+     * @internal
+     * @brief   Gets the extents of the hypercube tile of about s_default_tile_bytes, the extent
+     *          is the power of two.
+     */
+    static constexpr index_type default_tile_extents() noexcept
+    {
+        size_type extent = 1;
+        while (true)
+        {
+            size_type bytes = sizeof(T);
+            for (size_type dim = 0; dim < Rank; ++dim)
+            {
+                bytes *= extent * 2;
+            }
+            if (bytes > s_default_tile_bytes)
+            {
+                break;
+            }
+            extent *= 2;
+        }
+        index_type extents {};
+        extents.fill(extent);
+        return extents;
+    }
+
+private:
+    index_type m_extents;
+    index_type m_tile_extents;
+    index_type m_tile_grid {};
+    size_type m_tile_count = 0;
+    size_type m_tile_volume = 0;
+    std::unique_ptr<T[]> m_data {};
+    std::unique_ptr<tile_mutex[]> m_mutexes {};
+}; // class tiled_array
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace ts
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#endif // THREADSAFESMARTPOINTERS_TS_TILED_ARRAY_H
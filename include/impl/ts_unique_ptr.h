@@ -10,11 +10,21 @@
  */
 
 
+#include <cstddef>
+#include <cstdint>
+#include <future>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <type_traits>
+#include <utility>
 
 #include "impl/ts_config.h"
+#include "impl/ts_file_io.h"
+#include "impl/ts_footprint.h"
+#include "impl/ts_lock_token.h"
+#include "impl/ts_mutex.h"
+#include "impl/ts_thread_annotations.h"
 #include "ts_null_ptr_exception.h"
 
 
@@ -78,11 +88,11 @@ namespace ts {
  * @tparam TDeleter The type of deleter (optional by default std::default_delete<T>)
  */
 template <typename T, typename TMutex = std::mutex, typename TDeleter = std::default_delete<T>>
-class unique_ptr
+class TS_CAPABILITY("mutex") unique_ptr
 {
     using t_unique_ptr = std::unique_ptr<T, TDeleter>;
-    using t_mutex = TMutex;
-    using t_unique_lock = std::unique_lock<t_mutex>;
+    using t_mutex = impl::t_pointer_mutex<TMutex>;
+    using t_unique_lock = impl::t_write_lock<t_mutex>;
     using t_element_type = typename t_unique_ptr::element_type;
 
 public:
@@ -133,7 +143,7 @@ private:
          * @param mtx   The mutex reference for locking.
          * @param ptr   The object pointer for giving to a user.
          */
-        proxy_locker(t_mutex& mtx, T* ptr) noexcept
+        proxy_locker(t_mutex& mtx, T* ptr) noexcept(!impl::lock_order_may_throw<t_mutex>)
             : m_lock(mtx)
             , m_ptr(ptr)
         {
@@ -205,7 +215,8 @@ private:
          * @param mtx   The mutex reference for locking.
          * @param ptr   The object pointer for giving to a user.
          */
-        proxy_locker_for_subscript(t_mutex& mtx, t_element_type* ptr) noexcept
+        proxy_locker_for_subscript(t_mutex& mtx, t_element_type* ptr)
+                noexcept(!impl::lock_order_may_throw<t_mutex>)
             : m_lock(mtx)
             , m_ptr(ptr)
         {
@@ -256,7 +267,7 @@ public:
      *              (void) queue.get()->pop();
      *          }
      */
-    void lock() const
+    void lock() const TS_ACQUIRE()
     {
         m_mtx.lock();
     }
@@ -265,7 +276,7 @@ public:
      * @brief   Unlocks the mutex.
      *          Using for solve API races.
      */
-    void unlock() const
+    void unlock() const TS_RELEASE()
     {
         m_mtx.unlock();
     }
@@ -276,11 +287,84 @@ public:
      *
      * @return  true if the lock was acquired successfully, otherwise false.
      */
-    bool try_lock() const
+    bool try_lock() const TS_TRY_ACQUIRE(true)
     {
         return m_mtx.try_lock();
     }
 
+    /**
+     * @brief   Checks the mutex is held by the current thread, available if the mutex is
+     *          ts::owner_aware_mutex.
+     *
+     * @return  true if the current thread holds the lock, otherwise false.
+     */
+    [[nodiscard]] bool is_locked_by_current_thread() const noexcept
+            requires(impl::is_owner_aware_lockable<t_mutex>)
+    {
+        return m_mtx.is_locked_by_current_thread();
+    }
+
+    /**
+     * @brief   Checks there are threads waiting for the mutex, available if the mutex is
+     *          ts::contention_aware_mutex.
+     *
+     * @return  true if there are waiters, otherwise false.
+     */
+    [[nodiscard]] bool has_waiters() const noexcept
+            requires(impl::is_contention_aware_lockable<t_mutex>)
+    {
+        return m_mtx.has_waiters();
+    }
+
+    /**
+     * @brief   Gets the number of the lock acquisitions by the waiters, available if the mutex is
+     *          ts::contention_aware_mutex.
+     *
+     * @return  The number of the handoffs.
+     */
+    [[nodiscard]] std::size_t handoff_count() const noexcept
+            requires(impl::is_contention_aware_lockable<t_mutex>)
+    {
+        return m_mtx.handoff_count();
+    }
+
+    /**
+     * @brief   Locks the mutex and returns the token which owns the lock. The object is
+     *          accessed through the token without additional locking, the helper functions
+     *          take the token instead of the pointer.
+     *
+     * @example auto queue_token = queue.acquire();
+     *          if (!queue_token->empty())
+     *          {
+     *              queue_token->pop();
+     *          }
+     * @return  The lock token.
+     */
+    [[nodiscard]] lock_token<unique_ptr> acquire() const
+    {
+        return lock_token<unique_ptr> { *this };
+    }
+
+    /**
+     * @brief   Gets the position of the mutex in the lock hierarchy, available if the mutex is
+     *          ts::ranked_mutex. The multi-lock operations use it to lock in the rank order.
+     */
+    friend impl::lock_order_key lock_order_key_of(const unique_ptr& ptr) noexcept
+        requires(impl::is_ranked_lockable<t_mutex>)
+    {
+        return lock_order_key_of(ptr.m_mtx);
+    }
+
+    /**
+     * @brief   Gets the diagnostic state of the mutex, available if the mutex is
+     *          ts::instrumented_mutex.
+     */
+    friend impl::mutex_diagnostics& mutex_diagnostics_of(const unique_ptr& ptr) noexcept
+        requires(impl::is_instrumented_lockable<t_mutex>)
+    {
+        return mutex_diagnostics_of(ptr.m_mtx);
+    }
+
     /**
      * @brief   Gets raw pointer to object.
      *
@@ -312,6 +396,7 @@ public:
         : m_mtx {}
         , m_value(value_ptr)
     {
+        m_footprint.adopt(value_ptr, impl::object_bytes_of<T, t_element_type>());
     }
 
     /**
@@ -325,6 +410,7 @@ public:
         : m_mtx {}
         , m_value(value_ptr, deleter)
     {
+        m_footprint.adopt(value_ptr, impl::object_bytes_of<T, t_element_type>());
     }
 
     /**
@@ -333,16 +419,20 @@ public:
     unique_ptr(const unique_ptr&) = delete;
     unique_ptr& operator=(const unique_ptr&) = delete;
 
-    unique_ptr(unique_ptr&& other) noexcept
+    unique_ptr(unique_ptr&& other) noexcept(!impl::lock_order_may_throw<t_mutex>)
     {
-        std::scoped_lock lock { *this, other };
+        impl::ordered_lock lock { *this, other };
         this->m_value = std::move(other.m_value);
+        m_extent.set(std::exchange(other.m_extent, {}).get());
+        m_footprint.take(other.m_footprint);
     }
 
-    unique_ptr& operator=(unique_ptr&& other) noexcept
+    unique_ptr& operator=(unique_ptr&& other) noexcept(!impl::lock_order_may_throw<t_mutex>)
     {
-        std::scoped_lock lock { *this, other };
+        impl::ordered_lock lock { *this, other };
+        m_footprint.take(other.m_footprint);
         this->m_value = std::move(other.m_value);
+        m_extent.set(std::exchange(other.m_extent, {}).get());
         return *this;
     }
 
@@ -405,7 +495,7 @@ public:
      *
      * @return  true if *this owns an object, false otherwise.
      */
-    explicit operator bool() const noexcept
+    explicit operator bool() const noexcept(!impl::lock_order_may_throw<t_mutex>)
     {
         std::lock_guard lock { *this };
         return static_cast<bool>(m_value);
@@ -417,9 +507,11 @@ public:
      * @warning The caller is responsible for deleting the object.
      * @return  Pointer to the managed object or nullptr if there was no managed object.
      */
-    [[nodiscard]] pointer release() noexcept
+    [[nodiscard]] pointer release() noexcept(!impl::lock_order_may_throw<t_mutex>)
     {
         std::lock_guard lock { *this };
+        m_footprint.release();
+        m_extent.set(std::nullopt);
         return m_value.release();
     }
 
@@ -430,12 +522,114 @@ public:
      * @param new_pointer   Pointer to a new object to manage
      */
     template <typename TArgs = pointer>
-    void reset(TArgs new_pointer = nullptr) noexcept
+    void reset(TArgs new_pointer = nullptr) noexcept(!impl::lock_order_may_throw<t_mutex>)
     {
         std::lock_guard lock { *this };
+        m_footprint.release();
+        m_extent.set(std::nullopt);
         m_value.reset(new_pointer);
+        m_footprint.adopt(m_value.get(), impl::object_bytes_of<T, t_element_type>());
     }
 
+    /**
+     * @brief           Writes the [begin, end) range of the array to the file at the offset
+     *                  directly from the guarded memory, by pwritev under the read lock of the
+     *                  pointer. The range is not copied to the intermediate buffer.
+     *
+     * @example         auto p_buffer = ts::make_unique<std::byte[]>(1 << 20);
+     *                  p_buffer.write_to(fd, 0, 0, 1 << 20);
+     * @warning         The range is checked against the array length only if the array was
+     *                  created by ts::make_unique.
+     * @throws          ts::null_ptr_exception if the pointer is null.
+     * @throws          std::out_of_range if begin is greater than end, or end is greater than
+     *                  the array length.
+     * @throws          std::system_error if the write fails.
+     * @param fd        The file descriptor.
+     * @param offset    The offset in the file in bytes.
+     * @param begin     The index of the first element of the range.
+     * @param end       The index after the last element of the range.
+     * @return          The count of written bytes.
+     */
+    std::size_t write_to(int fd, std::uint64_t offset, std::size_t begin, std::size_t end) const
+            requires(impl::is_file_io_element<T>)
+    {
+        impl::t_read_lock<t_mutex> lock { m_mtx };
+        return impl::write_file(fd, offset
+                , std::as_bytes(impl::file_io_range(m_value.get(), begin, end, m_extent.get())));
+    }
+
+    /**
+     * @brief           Reads the [begin, end) range of the array from the file at the offset
+     *                  directly to the guarded memory, by preadv under the lock of the pointer.
+     *
+     * @return          The count of read bytes, less than the range size at the end of the file.
+     */
+    std::size_t read_from(int fd, std::uint64_t offset, std::size_t begin, std::size_t end)
+            requires(impl::is_file_io_element<T>)
+    {
+        t_unique_lock lock { m_mtx };
+        return impl::read_file(fd, offset, std::as_writable_bytes(
+                impl::file_io_range(m_value.get(), begin, end, m_extent.get())));
+    }
+
+    /**
+     * @brief           Submits write_to to the executor (e.g. ts::thread_pool), the lock is held
+     *                  only while the kernel consumes the data.
+     *
+     * @warning         The task refers to this pointer, the pointer must not be moved, released,
+     *                  reset or destroyed until the future is ready.
+     * @return          The future of the count of written bytes.
+     */
+    template <typename TExecutor>
+    std::future<std::size_t> write_to_async(TExecutor& executor, int fd, std::uint64_t offset
+            , std::size_t begin, std::size_t end) const
+            requires(impl::is_file_io_element<T>)
+    {
+        return executor.submit([this, fd, offset, begin, end]()
+        {
+            return write_to(fd, offset, begin, end);
+        });
+    }
+
+    /**
+     * @brief           Submits read_from to the executor (e.g. ts::thread_pool).
+     *
+     * @warning         The task refers to this pointer, the pointer must not be moved, released,
+     *                  reset or destroyed until the future is ready.
+     * @return          The future of the count of read bytes.
+     */
+    template <typename TExecutor>
+    std::future<std::size_t> read_from_async(TExecutor& executor, int fd, std::uint64_t offset
+            , std::size_t begin, std::size_t end)
+            requires(impl::is_file_io_element<T>)
+    {
+        return executor.submit([this, fd, offset, begin, end]()
+        {
+            return read_from(fd, offset, begin, end);
+        });
+    }
+
+    /**
+     * @brief   Samples the dynamic size of the object reported by footprint_dynamic_size again,
+     *          e.g. after the container is filled. Does nothing if the footprint accounting is
+     *          disabled.
+     */
+    void update_footprint() const
+    {
+        if constexpr (impl::config::s_track_footprint && !std::is_array_v<T>)
+        {
+            std::lock_guard lock { *this };
+            if (nullptr != m_value)
+            {
+                m_footprint.update(*m_value);
+            }
+        }
+    }
+
+private:
+    template <class U>
+    friend std::enable_if_t<std::is_array<U>::value, unique_ptr<U>> make_unique(std::size_t n);
+
 private:
     /**
      * The mutex for providing object thread-safety.
@@ -446,6 +640,17 @@ private:
      * The non-thread-safe unique pointer for manage object lifetime.
      */
     t_unique_ptr m_value{};
+
+    /**
+     * The length of the array created by ts::make_unique, empty for the single object.
+     */
+    [[no_unique_address]] impl::array_extent<T> m_extent {};
+
+    /**
+     * The footprint accounting of the mutex and the object, empty if it's disabled. Declared
+     * after the object, so the accounting of the object ends before its deletion.
+     */
+    [[no_unique_address]] mutable impl::t_footprint_member<T, t_mutex> m_footprint {};
 }; // class unique_ptr
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -487,7 +692,10 @@ template <class T>
 std::enable_if_t<std::is_array<T>::value, unique_ptr<T>> make_unique(std::size_t n)
 {
     using t_element_type = typename std::remove_extent_t<T>;
-    return unique_ptr<T>(new t_element_type[n]);
+    unique_ptr<T> ptr(new t_element_type[n]);
+    ptr.m_footprint.adopt(ptr.m_value.get(), n * sizeof(t_element_type));
+    ptr.m_extent.set(n);
+    return ptr;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -509,7 +717,7 @@ template <typename T1, typename M1, typename D1, typename T2, typename M2, typen
     using t_ptr1 = impl::to_row_t<T1, M1, D1>;
     using t_ptr2 = impl::to_row_t<T2, M2, D2>;
     using t_common = std::common_type_t<t_ptr1, t_ptr2>;
-    std::scoped_lock lock { left, right };
+    impl::ordered_lock lock { left, right };
     return std::less<t_common> {}(left.get(), right.get());
 }
 
@@ -538,7 +746,7 @@ template <typename T1, typename M1, typename D1, typename T2, typename M2, typen
     {
         return true;
     }
-    std::scoped_lock lock { left, right };
+    impl::ordered_lock lock { left, right };
     return left.get() == right.get();
 }
 
@@ -552,7 +760,7 @@ requires std::three_way_comparable_with<impl::to_row_t<T1, M1, D1>, impl::to_row
         std::lock_guard lock { left };
         return left.get() <=> right.get();
     }
-    std::scoped_lock lock { left, right };
+    impl::ordered_lock lock { left, right };
     return left.get() <=> right.get();
 }
 
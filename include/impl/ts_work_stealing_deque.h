@@ -0,0 +1,212 @@
+#ifndef THREADSAFESMARTPOINTERS_TS_WORK_STEALING_DEQUE_H
+#define THREADSAFESMARTPOINTERS_TS_WORK_STEALING_DEQUE_H
+
+/**
+ * @file        ts_work_stealing_deque.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of Chase-Lev work-stealing deque.
+ * @date        10/18/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "impl/ts_config.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace ts::impl {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @internal
+ *
+ * @class       work_stealing_deque
+ * @brief       The lock-free Chase-Lev work-stealing deque of pointers.
+ *
+ * @details     The owner thread pushes and pops the items at the bottom end (LIFO), other
+ *              threads steal the items from the top end (FIFO). Only the last item is
+ *              contended between the owner and the thieves. The circular buffer grows when
+ *              it's full, the old buffers are kept until the deque destruction because the
+ *              thieves may still read them.
+ * @tparam T    The type of the items, the deque stores T*.
+ */
+template <typename T>
+class work_stealing_deque
+{
+    /**
+     * @internal
+     * @brief   The circular buffer with power of two capacity.
+     */
+    class ring
+    {
+    public:
+        explicit ring(std::int64_t capacity)
+            : m_capacity(capacity)
+            , m_items(std::make_unique<std::atomic<T*>[]>(static_cast<std::size_t>(capacity)))
+        {
+        }
+
+        [[nodiscard]] std::int64_t capacity() const noexcept
+        {
+            return m_capacity;
+        }
+
+        void put(std::int64_t index, T* item) noexcept
+        {
+            m_items[slot(index)].store(item, std::memory_order_relaxed);
+        }
+
+        T* get(std::int64_t index) const noexcept
+        {
+            return m_items[slot(index)].load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief   Creates the buffer with double capacity and copies the items [top, bottom).
+         */
+        std::unique_ptr<ring> grow(std::int64_t top, std::int64_t bottom) const
+        {
+            auto p_new = std::make_unique<ring>(m_capacity * 2);
+            for (std::int64_t i = top; i < bottom; ++i)
+            {
+                p_new->put(i, get(i));
+            }
+            return p_new;
+        }
+
+    private:
+        std::size_t slot(std::int64_t index) const noexcept
+        {
+            return static_cast<std::size_t>(index & (m_capacity - 1));
+        }
+
+        const std::int64_t m_capacity;
+        std::unique_ptr<std::atomic<T*>[]> m_items;
+    };
+
+public:
+    /**
+     * @brief           Constructs the empty deque.
+     *
+     * @param capacity  The initial capacity, should be power of two.
+     */
+    explicit work_stealing_deque(std::int64_t capacity = 256)
+    {
+        m_rings.push_back(std::make_unique<ring>(capacity));
+        m_ring.store(m_rings.back().get(), std::memory_order_relaxed);
+    }
+
+    work_stealing_deque(const work_stealing_deque&) = delete;
+    work_stealing_deque(work_stealing_deque&&) = delete;
+    work_stealing_deque& operator=(const work_stealing_deque&) = delete;
+    work_stealing_deque& operator=(work_stealing_deque&&) = delete;
+    ~work_stealing_deque() = default;
+
+    /**
+     * @brief       Pushes the item at the bottom. Only the owner thread can call it.
+     *
+     * @param item  The item pointer.
+     */
+    void push(T* item)
+    {
+        const std::int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+        const std::int64_t top = m_top.load(std::memory_order_acquire);
+        ring* p_ring = m_ring.load(std::memory_order_relaxed);
+        // The owner sees top <= bottom, the unsigned size avoids the signed overflow folding.
+        const auto size = static_cast<std::uint64_t>(bottom) - static_cast<std::uint64_t>(top);
+        if (size >= static_cast<std::uint64_t>(p_ring->capacity()))
+        {
+            m_rings.push_back(p_ring->grow(top, bottom));
+            p_ring = m_rings.back().get();
+            m_ring.store(p_ring, std::memory_order_release);
+        }
+        p_ring->put(bottom, item);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief   Pops the item from the bottom. Only the owner thread can call it.
+     *
+     * @return  The item pointer or nullptr if the deque is empty.
+     */
+    T* pop()
+    {
+        const std::int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+        ring* p_ring = m_ring.load(std::memory_order_relaxed);
+        m_bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t top = m_top.load(std::memory_order_relaxed);
+        if (top > bottom)
+        {
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        T* item = p_ring->get(bottom);
+        if (top == bottom)
+        {
+            if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst
+                    , std::memory_order_relaxed))
+            {
+                item = nullptr;
+            }
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+        return item;
+    }
+
+    /**
+     * @brief   Steals the item from the top. Any thread can call it.
+     *
+     * @return  The item pointer or nullptr if the deque is empty or the race is lost.
+     */
+    T* steal()
+    {
+        std::int64_t top = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const std::int64_t bottom = m_bottom.load(std::memory_order_acquire);
+        if (top >= bottom)
+        {
+            return nullptr;
+        }
+        T* item = m_ring.load(std::memory_order_acquire)->get(top);
+        if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst
+                , std::memory_order_relaxed))
+        {
+            return nullptr;
+        }
+        return item;
+    }
+
+    /**
+     * @brief   Checks the deque is empty, the result may be outdated.
+     *
+     * @return  true if the deque is empty, otherwise false.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return m_top.load(std::memory_order_relaxed) >= m_bottom.load(std::memory_order_relaxed);
+    }
+
+private:
+    alignas(config::s_cache_line_size) std::atomic<std::int64_t> m_top { 0 };
+    alignas(config::s_cache_line_size) std::atomic<std::int64_t> m_bottom { 0 };
+    std::atomic<ring*> m_ring { nullptr };
+
+    /**
+     * All buffers ever used, owned by the owner thread.
+     */
+    std::vector<std::unique_ptr<ring>> m_rings {};
+}; // class work_stealing_deque
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace ts::impl
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#endif // THREADSAFESMARTPOINTERS_TS_WORK_STEALING_DEQUE_H
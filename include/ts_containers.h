@@ -0,0 +1,20 @@
+#ifndef THREADSAFESMARTPOINTERS_TS_CONTAINERS_H
+#define THREADSAFESMARTPOINTERS_TS_CONTAINERS_H
+
+/**
+ * @file        ts_containers.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of concurrent containers.
+ * @date        10/18/2026
+ * @copyright   Copyright (c) 2026
+ */
+
+#include "impl/ts_append_buffer.h"
+#include "impl/ts_concurrent_lru.h"
+#include "impl/ts_concurrent_vector.h"
+#include "impl/ts_concurrent_ordered_map.h"
+#include "impl/ts_concurrent_stack.h"
+#include "impl/ts_relaxed_priority_queue.h"
+#include "impl/ts_tiled_array.h"
+
+#endif // THREADSAFESMARTPOINTERS_TS_CONTAINERS_H
@@ -0,0 +1,19 @@
+#ifndef THREADSAFESMARTPOINTERS_TS_DIAGNOSTICS_H
+#define THREADSAFESMARTPOINTERS_TS_DIAGNOSTICS_H
+
+/**
+ * @file        ts_diagnostics.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the lock diagnostics.
+ * @date        10/18/2026
+ * @copyright   Copyright (c) 2026
+ */
+
+#include "impl/ts_accounting_scope.h"
+#include "impl/ts_cache_line_report.h"
+#include "impl/ts_contention_profiler.h"
+#include "impl/ts_footprint.h"
+#include "impl/ts_lock_sampler.h"
+#include "impl/ts_lock_trace.h"
+
+#endif // THREADSAFESMARTPOINTERS_TS_DIAGNOSTICS_H
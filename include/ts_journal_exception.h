@@ -0,0 +1,44 @@
+#ifndef THREADSAFESMARTPOINTERS_JOURNALEXCEPTION_H
+#define THREADSAFESMARTPOINTERS_JOURNALEXCEPTION_H
+
+/**
+ * @file        ts_journal_exception.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the journal I/O exception.
+ * @date        10/18/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#include <stdexcept>
+#include <string>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace ts {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @class journal_exception
+ *
+ * @brief The exception class for handling failures of the journal and checkpoint files.
+ */
+class journal_exception : public std::runtime_error
+{
+public:
+    ~journal_exception() override = default;
+    journal_exception(journal_exception&&) = default;
+    journal_exception(const journal_exception&) = default;
+    journal_exception& operator=(journal_exception&&) = default;
+    journal_exception& operator=(const journal_exception&) = default;
+
+    explicit journal_exception(const std::string& message)
+        : std::runtime_error(message)
+    { }
+}; // class journal_exception
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace ts
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#endif //THREADSAFESMARTPOINTERS_JOURNALEXCEPTION_H
@@ -0,0 +1,43 @@
+#ifndef THREADSAFESMARTPOINTERS_LOCKORDEREXCEPTION_H
+#define THREADSAFESMARTPOINTERS_LOCKORDEREXCEPTION_H
+
+/**
+ * @file        ts_lock_order_exception.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of the lock hierarchy violation exception.
+ * @date        10/18/2026.
+ * @copyright   Copyright (c) 2026
+ */
+
+#include <stdexcept>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace ts {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @class lock_order_exception
+ *
+ * @brief The exception class for handling lock hierarchy violations of the ranked mutexes.
+ */
+class lock_order_exception : public std::logic_error
+{
+public:
+    ~lock_order_exception() override = default;
+    lock_order_exception(lock_order_exception&&) = default;
+    lock_order_exception(const lock_order_exception&) = default;
+    lock_order_exception& operator=(lock_order_exception&&) = default;
+    lock_order_exception& operator=(const lock_order_exception&) = default;
+
+    explicit lock_order_exception(const char* message) noexcept
+        : std::logic_error(message)
+    { }
+}; // class lock_order_exception
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace ts
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#endif //THREADSAFESMARTPOINTERS_LOCKORDEREXCEPTION_H
@@ -11,5 +11,8 @@
 
 #include "impl/ts_unique_ptr.h"
 #include "impl/ts_shared_ptr.h"
+#include "impl/ts_left_right_ptr.h"
+#include "impl/ts_replicated_ptr.h"
+#include "impl/ts_journaled_ptr.h"
 
 #endif // THREADSAFESMARTPOINTERS_TS_MEMORY_H
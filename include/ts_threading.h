@@ -0,0 +1,15 @@
+#ifndef THREADSAFESMARTPOINTERS_TS_THREADING_H
+#define THREADSAFESMARTPOINTERS_TS_THREADING_H
+
+/**
+ * @file        ts_threading.h
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       Declaration and implementations of threading utilities.
+ * @date        10/18/2026
+ * @copyright   Copyright (c) 2026
+ */
+
+#include "impl/ts_lock_any.h"
+#include "impl/ts_thread_pool.h"
+
+#endif // THREADSAFESMARTPOINTERS_TS_THREADING_H
@@ -10,11 +10,23 @@
 #include <map>
 #include <thread>
 #include <queue>
+#include <ranges>
+#include <set>
 #include <atomic>
+#include <filesystem>
+#include <cstdio>
+#include <fstream>
+#include <latch>
+#include <numeric>
+#include <span>
+#include <sstream>
 
 #include <gtest/gtest.h>
 
 #include <ts_memory.h>
+#include <ts_containers.h>
+#include <ts_threading.h>
+#include <ts_diagnostics.h>
 
 class dummy_object
 {
@@ -1222,9 +1234,2326 @@ TEST(shared_ptr_api_testing, compares_a_initialized_shared_ptr_and_nullptr)
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+// ts::ranked_mutex testing.
+////////////////////////////////////////////////////////////////////////////////
+
+using t_low_rank_mutex = ts::ranked_mutex<std::mutex, 10>;
+using t_high_rank_mutex = ts::ranked_mutex<std::mutex, 20>;
+
+TEST(ranked_mutex_api_testing, multi_lock_operations)
+{
+    ts::shared_ptr<int32_t, t_low_rank_mutex> first { new int32_t { 1 } };
+    ts::shared_ptr<int32_t, t_low_rank_mutex> second { new int32_t { 2 } };
+    auto first_copy = first;
+    ASSERT_FALSE(first == second);
+    ASSERT_TRUE(first == first_copy);
+    first = second;
+    ASSERT_TRUE(first == second);
+
+    ts::unique_ptr<int32_t, t_high_rank_mutex> unique_first { new int32_t { 1 } };
+    ts::unique_ptr<int32_t, t_high_rank_mutex> unique_second { new int32_t { 2 } };
+    ASSERT_TRUE(unique_first < unique_second || unique_second < unique_first);
+    unique_first = std::move(unique_second);
+    ASSERT_EQ(*(unique_first.get()), 2);
+}
+
+TEST(ranked_mutex_api_testing, lock_order_violation)
+{
+    ts::shared_ptr<int32_t, t_low_rank_mutex> low { new int32_t { 1 } };
+    ts::unique_ptr<int32_t, t_high_rank_mutex> high { new int32_t { 2 } };
+    {
+        std::lock_guard low_lock { low };
+        std::lock_guard high_lock { high };
+    }
+    if constexpr (ts::impl::config::s_check_lock_order)
+    {
+        std::lock_guard high_lock { high };
+        ASSERT_THROW(low.lock(), ts::lock_order_exception);
+    }
+    ASSERT_TRUE(low.try_lock());
+    low.unlock();
+}
+
+TEST(ranked_mutex_api_testing, lock_order_violation_through_proxy)
+{
+    ts::shared_ptr<std::vector<int32_t>, t_low_rank_mutex> p_low { new std::vector<int32_t> {} };
+    ts::unique_ptr<int32_t, t_high_rank_mutex> p_high { new int32_t { 2 } };
+    static_assert(noexcept(p_high.reset()) == !ts::impl::config::s_check_lock_order);
+    static_assert(noexcept(std::declval<ts::shared_ptr<int32_t>&>().reset()));
+    if constexpr (ts::impl::config::s_check_lock_order)
+    {
+        std::lock_guard high_lock { p_high };
+        ASSERT_THROW(p_low->push_back(1), ts::lock_order_exception);
+        ASSERT_THROW((*p_low)[0], ts::lock_order_exception);
+        ASSERT_THROW(p_low.reset(), ts::lock_order_exception);
+    }
+    p_low->push_back(1);
+    ASSERT_EQ(p_low.get()->size(), 1);
+}
+
+TEST(ranked_mutex_api_testing, lock_order_after_try_lock)
+{
+    ts::ranked_mutex<std::mutex, 15> middle;
+    ts::shared_ptr<int32_t, t_low_rank_mutex> p_low { new int32_t { 1 } };
+    ts::unique_ptr<int32_t, t_high_rank_mutex> p_high { new int32_t { 2 } };
+    std::lock_guard high_lock { p_high };
+    ASSERT_TRUE(p_low.try_lock());
+    if constexpr (ts::impl::config::s_check_lock_order)
+    {
+        ASSERT_THROW(middle.lock(), ts::lock_order_exception);
+    }
+    p_low.unlock();
+}
+
+TEST(ranked_mutex_thread_safety_testing, concurrent_opposite_comparisons)
+{
+    const auto hardware_concurrency = std::thread::hardware_concurrency() != 0
+            ? std::thread::hardware_concurrency()
+            : 2;
+    constexpr int32_t compare_count = 10000;
+
+    ts::shared_ptr<int32_t, t_low_rank_mutex> first { new int32_t { 1 } };
+    ts::shared_ptr<int32_t, t_low_rank_mutex> second { new int32_t { 2 } };
+    std::atomic<int32_t> equal_count { 0 };
+
+    std::vector<std::thread> arr_threads;
+    for (uint32_t i = 0; i < hardware_concurrency; ++i)
+    {
+        arr_threads.emplace_back([&first, &second, &equal_count, i]()
+        {
+            for (int32_t j = 0; j < compare_count; ++j)
+            {
+                const bool is_equal = (i % 2 == 0) ? (first == second) : (second == first);
+                equal_count += is_equal ? 1 : 0;
+            }
+        });
+    }
+
+    std::ranges::for_each(arr_threads, std::mem_fn(&std::thread::join));
+
+    ASSERT_EQ(equal_count.load(), 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ts::lock_token testing.
+////////////////////////////////////////////////////////////////////////////////
+
+using t_queue_ptr = ts::shared_ptr<std::queue<int32_t>>;
+
+void push_if_empty(ts::lock_token<t_queue_ptr>& queue, int32_t value)
+{
+    if (queue->empty())
+    {
+        queue->push(value);
+    }
+}
+
+TEST(lock_token_api_testing, acquire)
+{
+    auto p_queue = ts::make_shared<std::queue<int32_t>>();
+    {
+        auto queue = p_queue.acquire();
+        push_if_empty(queue, 13);
+        push_if_empty(queue, 42);
+        ASSERT_EQ(queue->size(), 1);
+        ASSERT_EQ((*queue).front(), 13);
+        ASSERT_EQ(&(queue.owner()), &p_queue);
+        ASSERT_FALSE(p_queue.try_lock());
+    }
+    ASSERT_TRUE(p_queue.try_lock());
+    p_queue.unlock();
+
+    ts::unique_ptr<int32_t[]> p_arr { new int32_t[3] { 1, 2, 3 } };
+    {
+        auto arr = p_arr.acquire();
+        arr[1] = 13;
+    }
+    ASSERT_EQ(p_arr.get()[1], 13);
+}
+
+TEST(lock_token_api_testing, read_only_token_owns_shared_lock)
+{
+    ts::shared_ptr<int32_t, std::shared_mutex> p_value { new int32_t { 13 } };
+    ts::shared_ptr<const int32_t, std::shared_mutex> p_view = p_value;
+    static_assert(std::is_same_v<ts::lock_token<decltype(p_view)>::lock_type
+            , std::shared_lock<const decltype(p_view)>>);
+
+    auto first = p_view.acquire();
+    auto second = p_view.acquire();
+    ASSERT_EQ(*first, 13);
+    ASSERT_EQ(*second, 13);
+}
+
+TEST(lock_token_thread_safety_testing, read_modify_write)
+{
+    const auto hardware_concurrency = std::thread::hardware_concurrency() != 0
+            ? std::thread::hardware_concurrency()
+            : 2;
+    constexpr int32_t increment_count = 10000;
+
+    auto p_pair = ts::make_shared<std::pair<int32_t, int32_t>>(0, 0);
+
+    std::vector<std::thread> arr_threads;
+    for (uint32_t i = 0; i < hardware_concurrency; ++i)
+    {
+        arr_threads.emplace_back([&p_pair]()
+        {
+            for (int32_t j = 0; j < increment_count; ++j)
+            {
+                auto pair = p_pair.acquire();
+                pair->first = pair->first + 1;
+                pair->second = pair->first;
+            }
+        });
+    }
+
+    std::ranges::for_each(arr_threads, std::mem_fn(&std::thread::join));
+
+    const auto expected = static_cast<int32_t>(hardware_concurrency) * increment_count;
+    ASSERT_EQ(p_pair.get()->first, expected);
+    ASSERT_EQ(p_pair.get()->second, expected);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ts::owner_aware_mutex testing.
+////////////////////////////////////////////////////////////////////////////////
+
+struct reentrant_counter
+{
+    using t_ptr = ts::shared_ptr<reentrant_counter, ts::owner_aware_mutex<>>;
+
+    void increment()
+    {
+        ++m_value;
+    }
+
+    void increment_twice()
+    {
+        (*m_p_self)->increment();
+        auto self = m_p_self->acquire();
+        self->increment();
+    }
+
+    t_ptr* m_p_self = nullptr;
+    int32_t m_value = 0;
+};
+
+TEST(owner_aware_mutex_api_testing, nested_access)
+{
+    reentrant_counter::t_ptr p_counter { new reentrant_counter {} };
+    p_counter.get()->m_p_self = &p_counter;
+    ASSERT_FALSE(p_counter.is_locked_by_current_thread());
+
+    p_counter->increment_twice();
+    ASSERT_EQ(p_counter.get()->m_value, 2);
+    ASSERT_FALSE(p_counter.is_locked_by_current_thread());
+    {
+        std::lock_guard lock { p_counter };
+        ASSERT_TRUE(p_counter.is_locked_by_current_thread());
+        p_counter->increment();
+    }
+    ASSERT_FALSE(p_counter.is_locked_by_current_thread());
+    ASSERT_TRUE(p_counter.try_lock());
+    p_counter.unlock();
+
+    ts::unique_ptr<int32_t[], ts::owner_aware_mutex<>> p_arr { new int32_t[2] { 1, 2 } };
+    {
+        auto arr = p_arr.acquire();
+        (*p_arr)[0] = arr[1];
+    }
+    ASSERT_EQ(p_arr.get()[0], 2);
+}
+
+TEST(owner_aware_mutex_api_testing, shared_readers)
+{
+    using t_mutex = ts::owner_aware_mutex<std::shared_mutex>;
+    ts::shared_ptr<std::vector<int32_t>, t_mutex> p_vec { new std::vector<int32_t> { 1 } };
+    ts::shared_ptr<const std::vector<int32_t>, t_mutex> p_view = p_vec;
+
+    p_view.lock_shared();
+    ASSERT_FALSE(p_view.is_locked_by_current_thread());
+    auto size = std::async(std::launch::async, [&p_view]() { return p_view->size(); });
+    ASSERT_EQ(size.get(), 1);
+    p_view.unlock_shared();
+
+    {
+        std::lock_guard lock { p_vec };
+        ASSERT_TRUE(p_vec.is_locked_by_current_thread());
+        p_vec->push_back(2);
+    }
+    ASSERT_EQ(p_view->size(), 2);
+}
+
+TEST(owner_aware_mutex_thread_safety_testing, concurrent_nested_access)
+{
+    const auto hardware_concurrency = std::thread::hardware_concurrency() != 0
+            ? std::thread::hardware_concurrency()
+            : 2;
+    constexpr int32_t call_count = 10000;
+
+    reentrant_counter::t_ptr p_counter { new reentrant_counter {} };
+    p_counter.get()->m_p_self = &p_counter;
+
+    std::vector<std::thread> arr_threads;
+    for (uint32_t i = 0; i < hardware_concurrency; ++i)
+    {
+        arr_threads.emplace_back([&p_counter]()
+        {
+            for (int32_t j = 0; j < call_count; ++j)
+            {
+                p_counter->increment_twice();
+            }
+        });
+    }
+
+    std::ranges::for_each(arr_threads, std::mem_fn(&std::thread::join));
+
+    const auto expected = static_cast<int32_t>(hardware_concurrency) * call_count * 2;
+    ASSERT_EQ(p_counter.get()->m_value, expected);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ts::contention_aware_mutex testing.
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(contention_aware_mutex_api_testing, yield_without_waiters)
+{
+    ts::shared_ptr<std::vector<int32_t>, ts::contention_aware_mutex<>> p_vec {
+        new std::vector<int32_t> {} };
+    ASSERT_FALSE(p_vec.has_waiters());
+    {
+        auto vec = p_vec.acquire();
+        vec->push_back(13);
+        ASSERT_FALSE(vec.yield_if_contended());
+        ASSERT_EQ(vec->back(), 13);
+    }
+    ASSERT_EQ(p_vec.handoff_count(), 0);
+
+    ts::unique_ptr<int32_t, ts::contention_aware_mutex<std::shared_mutex>> p_value {
+        new int32_t { 13 } };
+    auto value = p_value.acquire();
+    ASSERT_FALSE(value.yield_if_contended());
+    ASSERT_EQ(*value, 13);
+}
+
+TEST(contention_aware_mutex_thread_safety_testing, long_holder_lets_waiters_through)
+{
+    const auto hardware_concurrency = std::thread::hardware_concurrency() != 0
+            ? std::thread::hardware_concurrency()
+            : 2;
+    constexpr int32_t request_count = 100;
+
+    ts::shared_ptr<std::vector<int32_t>, ts::contention_aware_mutex<>> p_vec {
+        new std::vector<int32_t> {} };
+    std::atomic<int32_t> served_count { 0 };
+    std::atomic_bool is_held { false };
+
+    std::vector<std::thread> arr_threads;
+    for (uint32_t i = 0; i < hardware_concurrency; ++i)
+    {
+        arr_threads.emplace_back([&p_vec, &served_count, &is_held]()
+        {
+            while (!is_held)
+            {
+                std::this_thread::yield();
+            }
+            for (int32_t j = 0; j < request_count; ++j)
+            {
+                p_vec->push_back(j);
+                ++served_count;
+            }
+        });
+    }
+
+    const auto expected = static_cast<int32_t>(hardware_concurrency) * request_count;
+    {
+        // The long-running holder, finishes only after all requests are served.
+        auto vec = p_vec.acquire();
+        is_held = true;
+        while (served_count.load() != expected)
+        {
+            (void) vec.yield_if_contended();
+            std::this_thread::yield();
+        }
+    }
+
+    std::ranges::for_each(arr_threads, std::mem_fn(&std::thread::join));
+
+    ASSERT_EQ(p_vec.get()->size(), static_cast<std::size_t>(expected));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ts::left_right_ptr testing.
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(left_right_ptr_api_testing, read_modify)
+{
+    ts::left_right_ptr<std::map<int32_t, std::string>> map_ptr;
+    ASSERT_TRUE(map_ptr->empty());
+    map_ptr.modify([](auto& map) { map[1] = "one"; });
+    map_ptr.modify([](auto& map) { map[2] = "two"; });
+    ASSERT_EQ(map_ptr->size(), 2);
+    ASSERT_EQ(map_ptr.read([](const auto& map) { return map.at(1); }), "one");
+    map_ptr.modify([](auto& map) { map.erase(1); });
+    ASSERT_EQ(map_ptr->size(), 1);
+    ASSERT_EQ(map_ptr->count(2), 1);
+}
+
+TEST(left_right_ptr_api_testing, constructor_with_arguments)
+{
+    ts::left_right_ptr<std::vector<int32_t>> vec_ptr { 3, 13 };
+    ASSERT_EQ(vec_ptr->size(), 3);
+    vec_ptr.modify([](auto& vec) { vec.push_back(42); });
+    ASSERT_EQ(vec_ptr.read([](const auto& vec) { return vec.back(); }), 42);
+}
+
+TEST(left_right_ptr_thread_safety_testing, readers_see_consistent_state)
+{
+    const auto hardware_concurrency = std::thread::hardware_concurrency() != 0
+            ? std::thread::hardware_concurrency()
+            : 2;
+    constexpr int32_t modify_count = 10000;
+
+    ts::left_right_ptr<std::vector<int32_t>> vec_ptr;
+    std::atomic_bool stop { false };
+    std::atomic<int32_t> mismatch_count { 0 };
+
+    std::vector<std::thread> arr_threads;
+    for (uint32_t i = 0; i < hardware_concurrency; ++i)
+    {
+        arr_threads.emplace_back([&vec_ptr, &stop, &mismatch_count]()
+        {
+            while (!stop)
+            {
+                vec_ptr.read([&mismatch_count](const std::vector<int32_t>& vec)
+                {
+                    for (std::size_t j = 0; j < vec.size(); ++j)
+                    {
+                        mismatch_count += (vec[j] != static_cast<int32_t>(j)) ? 1 : 0;
+                    }
+                });
+            }
+        });
+    }
+    for (int32_t i = 0; i < modify_count; ++i)
+    {
+        vec_ptr.modify([i](std::vector<int32_t>& vec) { vec.push_back(i); });
+    }
+    stop = true;
+
+    std::ranges::for_each(arr_threads, std::mem_fn(&std::thread::join));
+
+    ASSERT_EQ(mismatch_count.load(), 0);
+    ASSERT_EQ(vec_ptr->size(), modify_count);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ts::replicated_ptr testing.
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(replicated_ptr_api_testing, read_modify)
+{
+    ts::replicated_ptr<std::map<int32_t, std::string>> map_ptr;
+    ASSERT_GE(map_ptr.replica_count(), 1);
+    ASSERT_TRUE(map_ptr.read([](const auto& map) { return map.empty(); }));
+    map_ptr.modify([](auto& map) { map[1] = "one"; });
+    map_ptr.modify([](auto& map) { map[2] = "two"; });
+    ASSERT_EQ(map_ptr.read([](const auto& map) { return map.at(1); }), "one");
+    map_ptr.modify([](auto& map) { map.erase(1); });
+    ASSERT_EQ(map_ptr.read([](const auto& map) { return map.size(); }), 1);
+}
+
+TEST(replicated_ptr_api_testing, log_wraps_around)
+{
+    using t_replicated_vector = ts::replicated_ptr<std::vector<int32_t>>;
+    t_replicated_vector vec_ptr { t_replicated_vector::replication_options { 4 }, 3, 13 };
+    ASSERT_EQ(vec_ptr.replica_count(), 4);
+
+    constexpr auto modify_count = static_cast<int32_t>(3 * t_replicated_vector::s_log_capacity);
+    for (int32_t i = 0; i < modify_count; ++i)
+    {
+        vec_ptr.modify([i](auto& vec) { vec.push_back(i); });
+    }
+    ASSERT_EQ(vec_ptr.read([](const auto& vec) { return vec.size(); }), modify_count + 3);
+    ASSERT_EQ(vec_ptr.read([](const auto& vec) { return vec.back(); }), modify_count - 1);
+}
+
+TEST(replicated_ptr_thread_safety_testing, concurrent_read_modify)
+{
+    const auto hardware_concurrency = std::thread::hardware_concurrency() != 0
+            ? std::thread::hardware_concurrency()
+            : 2;
+    constexpr int32_t modify_count = 2000;
+
+    using t_replicated_vector = ts::replicated_ptr<std::vector<int32_t>>;
+    t_replicated_vector vec_ptr { t_replicated_vector::replication_options { 4 } };
+    std::atomic<int32_t> stale_count { 0 };
+
+    std::vector<std::thread> arr_threads;
+    for (uint32_t i = 0; i < hardware_concurrency; ++i)
+    {
+        arr_threads.emplace_back([&vec_ptr, &stale_count]()
+        {
+            for (int32_t j = 0; j < modify_count; ++j)
+            {
+                vec_ptr.modify([j](auto& vec) { vec.push_back(j); });
+                const bool is_stale = vec_ptr.read([j](const auto& vec)
+                {
+                    return std::ranges::find(vec, j) == vec.end();
+                });
+                stale_count += is_stale ? 1 : 0;
+            }
+        });
+    }
+
+    std::ranges::for_each(arr_threads, std::mem_fn(&std::thread::join));
+
+    ASSERT_EQ(stale_count.load(), 0);
+    const auto expected = static_cast<std::size_t>(hardware_concurrency) * modify_count;
+    ASSERT_EQ(vec_ptr.read([](const auto& vec) { return vec.size(); }), expected);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ts::journaled_ptr testing.
+////////////////////////////////////////////////////////////////////////////////
+
+struct journaled_counter
+{
+    int64_t m_value = 0;
+
+    void serialize(std::ostream& out) const
+    {
+        out << m_value;
+    }
+
+    static journaled_counter deserialize(std::istream& in)
+    {
+        journaled_counter counter;
+        in >> counter.m_value;
+        return counter;
+    }
+};
+
+struct journaled_add
+{
+    int64_t m_delta = 0;
+
+    void apply(journaled_counter& counter) const
+    {
+        counter.m_value += m_delta;
+    }
+
+    void serialize(std::ostream& out) const
+    {
+        out << m_delta;
+    }
+
+    static journaled_add deserialize(std::istream& in)
+    {
+        journaled_add add;
+        in >> add.m_delta;
+        return add;
+    }
+};
+
+using t_journaled_counter = ts::journaled_ptr<journaled_counter, journaled_add>;
+
+std::filesystem::path make_journal_path(const std::string& name)
+{
+    const auto directory = std::filesystem::temp_directory_path() / "ts_journal_testing";
+    std::filesystem::create_directories(directory);
+    const auto path = directory / name;
+    std::filesystem::remove(path);
+    std::filesystem::remove(std::filesystem::path { path } += ".checkpoint");
+    return path;
+}
+
+int64_t read_counter(const t_journaled_counter& p_counter)
+{
+    return p_counter.read([](const journaled_counter& counter) { return counter.m_value; });
+}
+
+TEST(journaled_ptr_api_testing, recovery_from_checkpoint_and_journal)
+{
+    const auto path = make_journal_path("recovery");
+    {
+        t_journaled_counter p_counter { path };
+        ASSERT_EQ(p_counter.apply(journaled_add { 10 }), 1);
+        p_counter.checkpoint();
+        ASSERT_EQ(p_counter.apply(journaled_add { 3 }), 2);
+        p_counter.flush();
+        ASSERT_EQ(p_counter.durable_lsn(), 2);
+    }
+    {
+        t_journaled_counter p_counter { path };
+        ASSERT_EQ(read_counter(p_counter), 13);
+        ASSERT_EQ(p_counter.apply(journaled_add { 1 }), 3);
+    }
+    {
+        // The torn record at the end of the journal is cut by the recovery.
+        std::ofstream journal { path, std::ios::binary | std::ios::app };
+        journal << "torn";
+    }
+    {
+        t_journaled_counter p_counter { path };
+        ASSERT_EQ(read_counter(p_counter), 14);
+        p_counter.apply(journaled_add { 1 });
+    }
+    t_journaled_counter p_counter { path };
+    ASSERT_EQ(read_counter(p_counter), 15);
+}
+
+TEST(journaled_ptr_thread_safety_testing, concurrent_apply_and_recovery)
+{
+    const auto hardware_concurrency = std::thread::hardware_concurrency() != 0
+            ? std::thread::hardware_concurrency()
+            : 2;
+    constexpr int32_t apply_count = 5000;
+
+    const auto path = make_journal_path("concurrent");
+    {
+        t_journaled_counter p_counter { t_journaled_counter::journal_options { 1000 }, path };
+
+        std::vector<std::thread> arr_threads;
+        for (uint32_t i = 0; i < hardware_concurrency; ++i)
+        {
+            arr_threads.emplace_back([&p_counter]()
+            {
+                for (int32_t j = 0; j < apply_count; ++j)
+                {
+                    p_counter.apply(journaled_add { 1 });
+                }
+            });
+        }
+
+        std::ranges::for_each(arr_threads, std::mem_fn(&std::thread::join));
+    }
+
+    t_journaled_counter p_counter { path };
+    ASSERT_EQ(read_counter(p_counter), static_cast<int64_t>(hardware_concurrency) * apply_count);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ts::concurrent_vector testing.
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(concurrent_vector_api_testing, push_back_and_at)
+{
+    ts::concurrent_vector<int32_t> vec;
+    ASSERT_TRUE(vec.empty());
+    for (int32_t i = 0; i < 100; ++i)
+    {
+        ASSERT_EQ(vec.push_back(i), static_cast<std::size_t>(i));
+    }
+    ASSERT_EQ(vec.size(), 100);
+    for (int32_t i = 0; i < 100; ++i)
+    {
+        ASSERT_EQ(vec[static_cast<std::size_t>(i)], i);
+        ASSERT_EQ(vec.at(static_cast<std::size_t>(i)), i);
+    }
+    EXPECT_THROW((void) vec.at(100), std::out_of_range);
+    ASSERT_FALSE(vec.is_published(100));
+}
+
+TEST(concurrent_vector_api_testing, grow_by)
+{
+    ts::concurrent_vector<int32_t> vec { 3 };
+    const auto first = vec.grow_by(5, 13);
+    ASSERT_EQ(first, 3);
+    ASSERT_EQ(vec.size(), 8);
+    ASSERT_EQ(vec[0], 0);
+    ASSERT_EQ(vec[7], 13);
+}
+
+TEST(concurrent_vector_api_testing, elements_are_not_relocated)
+{
+    ts::concurrent_vector<int32_t> vec;
+    (void) vec.push_back(13);
+    const int32_t* p_first = &vec[0];
+    (void) vec.grow_by(10000);
+    ASSERT_EQ(p_first, &vec[0]);
+    ASSERT_EQ(*p_first, 13);
+}
+
+TEST(concurrent_vector_api_testing, destroys_elements)
+{
+    {
+        ts::concurrent_vector<dummy_object> vec;
+        (void) vec.grow_by(100);
+        (void) vec.emplace_back();
+        ASSERT_EQ(dummy_object::ms_object_count, 101);
+    }
+    ASSERT_EQ(dummy_object::ms_object_count, 0);
+}
+
+TEST(concurrent_vector_thread_safety_testing, concurrent_insert)
+{
+    const auto hardware_concurrency = std::thread::hardware_concurrency() != 0
+            ? std::thread::hardware_concurrency()
+            : 2;
+    constexpr int32_t insert_per_thread = 1000;
+
+    ts::concurrent_vector<int32_t> vec;
+
+    std::vector<std::thread> arr_threads;
+    arr_threads.reserve(hardware_concurrency);
+    for (uint32_t i = 0; i < hardware_concurrency; ++i)
+    {
+        auto task = [&vec, base = static_cast<int32_t>(i) * insert_per_thread]()
+        {
+            for (int32_t j = 0; j < insert_per_thread; ++j)
+            {
+                if (j % 100 == 0)
+                {
+                    (void) vec.grow_by(2, j + base);
+                    ++j;
+                    continue;
+                }
+                (void) vec.push_back(j + base);
+            }
+        };
+        arr_threads.emplace_back(task);
+    }
+
+    auto reader = [&vec]()
+    {
+        std::size_t published = 0;
+        vec.for_each([&published](const int32_t&) { ++published; });
+        ASSERT_LE(published, vec.size());
+    };
+    arr_threads.emplace_back(reader);
+
+    std::ranges::for_each(arr_threads, std::mem_fn(&std::thread::join));
+
+    const auto target_size = insert_per_thread * hardware_concurrency;
+    ASSERT_EQ(vec.size(), target_size);
+    std::int64_t sum = 0;
+    vec.for_each([&sum](const int32_t& val) { sum += val; });
+    std::int64_t target_sum = 0;
+    for (uint32_t i = 0; i < hardware_concurrency; ++i)
+    {
+        const auto base = static_cast<int32_t>(i) * insert_per_thread;
+        for (int32_t j = 0; j < insert_per_thread; ++j)
+        {
+            target_sum += (j % 100 == 1) ? (j - 1 + base) : (j + base);
+        }
+    }
+    ASSERT_EQ(sum, target_sum);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+// ts::concurrent_ordered_map testing.
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(concurrent_ordered_map_api_testing, insert_find_erase)
+{
+    ts::concurrent_ordered_map<int32_t, int32_t> map;
+    ASSERT_TRUE(map.empty());
+    ASSERT_TRUE(map.insert(2, 20));
+    ASSERT_TRUE(map.insert(1, 10));
+    ASSERT_FALSE(map.insert(1, 11));
+    ASSERT_EQ(map.size(), 2);
+    ASSERT_EQ(map.find(1), 10);
+    ASSERT_EQ(map.find(2), 20);
+    ASSERT_FALSE(map.find(3).has_value());
+    ASSERT_TRUE(map.erase(1));
+    ASSERT_FALSE(map.erase(1));
+    ASSERT_FALSE(map.contains(1));
+    ASSERT_TRUE(map.contains(2));
+    ASSERT_TRUE(map.insert(1, 11));
+    ASSERT_EQ(map.find(1), 11);
+}
+
+TEST(concurrent_ordered_map_api_testing, ordered_range_scan)
+{
+    ts::concurrent_ordered_map<int32_t, std::string> map;
+    for (int32_t i = 99; i >= 0; --i)
+    {
+        ASSERT_TRUE(map.insert(i, std::to_string(i)));
+    }
+
+    std::vector<int32_t> keys;
+    map.range_scan(10, 20, [&keys](const int32_t& key, const std::string& value)
+    {
+        ASSERT_EQ(std::to_string(key), value);
+        keys.push_back(key);
+    });
+    ASSERT_EQ(keys.size(), 10);
+    ASSERT_TRUE(std::ranges::is_sorted(keys));
+    ASSERT_EQ(keys.front(), 10);
+    ASSERT_EQ(keys.back(), 19);
+
+    int32_t count = 0;
+    map.for_each([&count](const int32_t& key, const std::string&) { ASSERT_EQ(key, count++); });
+    ASSERT_EQ(count, 100);
+}
+
+TEST(concurrent_ordered_map_thread_safety_testing, read_write)
+{
+    static constexpr int32_t insert_count = 1000;
+    ts::concurrent_ordered_map<int32_t, int32_t> map;
+
+    auto insert_task = [&map]()
+    {
+        for (int32_t i = 0; i < insert_count; ++i)
+        {
+            ASSERT_TRUE(map.insert(i, i));
+        }
+    };
+
+    auto erase_task = [&map]()
+    {
+        for (int32_t i = 0; i < insert_count; ++i)
+        {
+            while (!map.contains(i))
+            {
+                std::this_thread::yield();
+            }
+            ASSERT_TRUE(map.erase(i));
+        }
+    };
+
+    auto check_task = [&map]()
+    {
+        for (int32_t pass = 0; pass < 10; ++pass)
+        {
+            int32_t prev = -1;
+            map.range_scan(0, insert_count, [&prev](const int32_t& key, const int32_t& value)
+            {
+                ASSERT_EQ(key, value);
+                ASSERT_LT(prev, key);
+                prev = key;
+            });
+        }
+    };
+
+    std::vector<std::thread> arr_threads;
+    for (int32_t i = 0; i < 4; ++i)
+    {
+        arr_threads.emplace_back(check_task);
+    }
+    arr_threads.emplace_back(insert_task);
+    arr_threads.emplace_back(erase_task);
+
+    std::ranges::for_each(arr_threads, std::mem_fn(&std::thread::join));
+
+    ASSERT_TRUE(map.empty());
+}
+
+TEST(concurrent_ordered_map_thread_safety_testing, concurrent_insert_erase)
+{
+    const auto hardware_concurrency = std::thread::hardware_concurrency() != 0
+            ? std::thread::hardware_concurrency()
+            : 2;
+    constexpr int32_t key_count = 256;
+    ts::concurrent_ordered_map<int32_t, int32_t> map;
+    std::atomic<int32_t> balance { 0 };
+
+    std::vector<std::thread> arr_threads;
+    for (uint32_t i = 0; i < hardware_concurrency + 1; ++i)
+    {
+        auto task = [&map, &balance, i]()
+        {
+            for (int32_t j = 0; j < 10000; ++j)
+            {
+                const int32_t key = (j * 7 + static_cast<int32_t>(i) * 13) % key_count;
+                if (map.insert(key, key))
+                {
+                    ++balance;
+                }
+                if (map.erase((key + 1) % key_count))
+                {
+                    --balance;
+                }
+            }
+        };
+        arr_threads.emplace_back(task);
+    }
+
+    std::ranges::for_each(arr_threads, std::mem_fn(&std::thread::join));
+
+    int32_t count = 0;
+    map.for_each([&count](const int32_t&, const int32_t&) { ++count; });
+    ASSERT_EQ(count, balance.load());
+    ASSERT_EQ(map.size(), static_cast<std::size_t>(count));
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+// ts::concurrent_stack testing.
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(concurrent_stack_api_testing, push_pop)
+{
+    ts::concurrent_stack<std::string> stack;
+    ASSERT_TRUE(stack.empty());
+    ASSERT_FALSE(stack.try_pop().has_value());
+    stack.push("first");
+    stack.emplace(3, 'a');
+    ASSERT_FALSE(stack.empty());
+    ASSERT_EQ(stack.try_pop(), "aaa");
+    ASSERT_EQ(stack.try_pop(), "first");
+    ASSERT_TRUE(stack.empty());
+}
+
+TEST(concurrent_stack_api_testing, push_range_pop_all)
+{
+    ts::concurrent_stack<int32_t> stack;
+    const std::vector<int32_t> arr_values { 1, 2, 3, 4 };
+    stack.push(0);
+    stack.push_range(arr_values.begin(), arr_values.end());
+    ASSERT_EQ(stack.try_pop(), 4);
+    const auto arr_popped = stack.pop_all();
+    ASSERT_EQ(arr_popped, (std::vector<int32_t> { 3, 2, 1, 0 }));
+    ASSERT_TRUE(stack.empty());
+    ASSERT_TRUE(stack.pop_all().empty());
+}
+
+TEST(concurrent_stack_api_testing, push_range_throwing_element)
+{
+    ts::concurrent_stack<std::shared_ptr<int32_t>> stack;
+    const auto p_value = std::make_shared<int32_t>(13);
+    const std::vector<int32_t> arr_indices { 0, 1, 2, 3 };
+    auto values = arr_indices | std::views::transform([&p_value](int32_t i)
+    {
+        if (i == 2)
+        {
+            throw std::runtime_error { "error" };
+        }
+        return p_value;
+    });
+    ASSERT_THROW(stack.push_range(values.begin(), values.end()), std::runtime_error);
+    ASSERT_EQ(p_value.use_count(), 1);
+    ASSERT_TRUE(stack.empty());
+}
+
+TEST(concurrent_stack_thread_safety_testing, concurrent_push_pop)
+{
+    const auto hardware_concurrency = std::thread::hardware_concurrency() != 0
+            ? std::thread::hardware_concurrency()
+            : 2;
+    constexpr int32_t push_per_thread = 10000;
+
+    ts::concurrent_stack<int32_t> stack;
+    std::atomic<int64_t> popped_sum { 0 };
+    std::atomic<int32_t> popped_count { 0 };
+
+    std::vector<std::thread> arr_threads;
+    for (uint32_t i = 0; i < hardware_concurrency; ++i)
+    {
+        auto producer = [&stack]()
+        {
+            for (int32_t j = 0; j < push_per_thread; ++j)
+            {
+                stack.push(j);
+            }
+        };
+        auto consumer = [&stack, &popped_sum, &popped_count]()
+        {
+            for (int32_t j = 0; j < push_per_thread; ++j)
+            {
+                if (auto val = stack.try_pop())
+                {
+                    popped_sum += *val;
+                    ++popped_count;
+                }
+            }
+        };
+        arr_threads.emplace_back(producer);
+        arr_threads.emplace_back(consumer);
+    }
+
+    std::ranges::for_each(arr_threads, std::mem_fn(&std::thread::join));
+
+    for (int32_t val : stack.pop_all())
+    {
+        popped_sum += val;
+        ++popped_count;
+    }
+    const auto thread_count = static_cast<int64_t>(hardware_concurrency);
+    ASSERT_EQ(popped_count.load(), push_per_thread * thread_count);
+    ASSERT_EQ(popped_sum.load(), thread_count * (push_per_thread - 1) * push_per_thread / 2);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ts::concurrent_lru testing.
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(concurrent_lru_api_testing, get_put_erase)
+{
+    ts::concurrent_lru<std::string, int32_t> cache { 16, 4 };
+    ASSERT_EQ(cache.shard_count(), 4);
+    ASSERT_EQ(cache.shard_capacity(), 4);
+    ASSERT_EQ(cache.capacity(), 16);
+    ASSERT_FALSE(cache.get("key").has_value());
+    cache.put("key", 13);
+    ASSERT_EQ(cache.get("key"), 13);
+    cache.put("key", 42);
+    ASSERT_EQ(cache.get("key"), 42);
+    ASSERT_TRUE(cache.contains("key"));
+    ASSERT_EQ(cache.size(), 1);
+    ASSERT_TRUE(cache.erase("key"));
+    ASSERT_FALSE(cache.erase("key"));
+    ASSERT_EQ(cache.size(), 0);
+}
+
+TEST(concurrent_lru_api_testing, clock_eviction_keeps_referenced_entries)
+{
+    ts::concurrent_lru<int32_t, int32_t> cache { 4, 1 };
+    for (int32_t i = 0; i < 4; ++i)
+    {
+        cache.put(i, i);
+    }
+    ASSERT_TRUE(cache.get(0).has_value());
+    ASSERT_TRUE(cache.get(2).has_value());
+    cache.put(4, 4);
+    ASSERT_EQ(cache.size(), 4);
+    ASSERT_TRUE(cache.contains(0));
+    ASSERT_FALSE(cache.contains(1));
+    ASSERT_TRUE(cache.contains(2));
+    ASSERT_TRUE(cache.contains(4));
+    cache.clear();
+    ASSERT_EQ(cache.size(), 0);
+}
+
+TEST(concurrent_lru_thread_safety_testing, concurrent_get_put)
+{
+    const auto hardware_concurrency = std::thread::hardware_concurrency() != 0
+            ? std::thread::hardware_concurrency()
+            : 2;
+    constexpr int32_t operation_count = 10000;
+    constexpr int32_t key_count = 1000;
+
+    ts::concurrent_lru<int32_t, int32_t> cache { 256 };
+    std::atomic<int32_t> mismatch_count { 0 };
+
+    std::vector<std::thread> arr_threads;
+    for (uint32_t i = 0; i < hardware_concurrency; ++i)
+    {
+        arr_threads.emplace_back([&cache, &mismatch_count, i]()
+        {
+            for (int32_t j = 0; j < operation_count; ++j)
+            {
+                const auto key = (j * 7 + static_cast<int32_t>(i)) % key_count;
+                if (auto val = cache.get(key))
+                {
+                    mismatch_count += (*val != key) ? 1 : 0;
+                }
+                else
+                {
+                    cache.put(key, key);
+                }
+            }
+        });
+    }
+
+    std::ranges::for_each(arr_threads, std::mem_fn(&std::thread::join));
+
+    ASSERT_EQ(mismatch_count.load(), 0);
+    ASSERT_LE(cache.size(), cache.capacity());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ts::relaxed_priority_queue testing.
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(relaxed_priority_queue_api_testing, strict_order)
+{
+    ts::relaxed_priority_queue<int32_t> queue { ts::priority_order::strict };
+    ASSERT_EQ(queue.heap_count(), 1);
+    ASSERT_FALSE(queue.try_pop().has_value());
+    for (int32_t i : { 5, 1, 9, 3, 7 })
+    {
+        queue.push(i);
+    }
+    ASSERT_EQ(queue.size(), 5);
+    for (int32_t i : { 9, 7, 5, 3, 1 })
+    {
+        ASSERT_EQ(queue.try_pop(), i);
+    }
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST(relaxed_priority_queue_api_testing, relaxed_order_returns_all_elements)
+{
+    ts::relaxed_priority_queue<int32_t, std::greater<>> queue { 8, std::greater<> {} };
+    for (int32_t i = 0; i < 100; ++i)
+    {
+        queue.emplace(i);
+    }
+    std::set<int32_t> popped;
+    std::size_t pop_count = 0;
+    while (auto val = queue.try_pop())
+    {
+        popped.insert(*val);
+        ++pop_count;
+    }
+    ASSERT_EQ(pop_count, 100);
+    ASSERT_EQ(popped.size(), 100);
+    ASSERT_EQ(*popped.begin(), 0);
+    ASSERT_EQ(*popped.rbegin(), 99);
+}
+
+TEST(relaxed_priority_queue_thread_safety_testing, concurrent_push_pop)
+{
+    const auto hardware_concurrency = std::thread::hardware_concurrency() != 0
+            ? std::thread::hardware_concurrency()
+            : 2;
+    constexpr int32_t push_per_thread = 1000;
+
+    ts::relaxed_priority_queue<int32_t> queue;
+    std::atomic<int64_t> popped_sum { 0 };
+    std::atomic<int32_t> popped_count { 0 };
+
+    std::vector<std::thread> arr_threads;
+    for (uint32_t i = 0; i < hardware_concurrency; ++i)
+    {
+        auto producer = [&queue]()
+        {
+            for (int32_t j = 0; j < push_per_thread; ++j)
+            {
+                queue.push(j);
+            }
+        };
+        auto consumer = [&queue, &popped_sum, &popped_count]()
+        {
+            for (int32_t j = 0; j < push_per_thread / 2; ++j)
+            {
+                if (auto val = queue.try_pop())
+                {
+                    popped_sum += *val;
+                    ++popped_count;
+                }
+            }
+        };
+        arr_threads.emplace_back(producer);
+        arr_threads.emplace_back(consumer);
+    }
+
+    std::ranges::for_each(arr_threads, std::mem_fn(&std::thread::join));
+
+    while (auto val = queue.try_pop())
+    {
+        popped_sum += *val;
+        ++popped_count;
+    }
+    const auto thread_count = static_cast<int64_t>(hardware_concurrency);
+    ASSERT_EQ(popped_count.load(), push_per_thread * thread_count);
+    ASSERT_EQ(popped_sum.load(), thread_count * (push_per_thread - 1) * push_per_thread / 2);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ts::tiled_array testing.
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(tiled_array_api_testing, tiles_and_regions)
+{
+    ts::tiled_array<int32_t, 2> grid { { 10, 7 }, { 4, 4 } };
+    ASSERT_EQ(grid.tile_grid(), (std::array<std::size_t, 2> { 3, 2 }));
+    ASSERT_EQ(grid.tile_count(), 6);
+    ASSERT_EQ(grid.tile_of({ 9, 5 }), (std::array<std::size_t, 2> { 2, 1 }));
+
+    grid.with_tile(2, 1, [](auto tile)
+    {
+        ASSERT_EQ(tile.data().size(), 16);
+        ASSERT_EQ(tile.origin(), (std::array<std::size_t, 2> { 8, 4 }));
+        ASSERT_EQ(tile.extents(), (std::array<std::size_t, 2> { 2, 3 }));
+        tile(1, 2) = 13;
+    });
+
+    grid.with_region({ { 0, 0 }, { 10, 7 } }, [](auto region)
+    {
+        ASSERT_EQ(region(9, 6), 13);
+        for (std::size_t i = 0; i < 10; ++i)
+        {
+            for (std::size_t j = 0; j < 7; ++j)
+            {
+                region(i, j) = static_cast<int32_t>(i * 7 + j);
+            }
+        }
+    });
+
+    const auto& const_grid = grid;
+    const auto sum = const_grid.with_tile(0, 0, [](auto tile)
+    {
+        static_assert(std::is_const_v<std::remove_reference_t<decltype(tile(0, 0))>>);
+        return tile(0, 0) + tile(3, 3);
+    });
+    ASSERT_EQ(sum, 24);
+    ASSERT_EQ(const_grid.with_region({ { 3, 3 }, { 5, 5 } }, [](auto region)
+    {
+        return region(4, 4);
+    }), 32);
+
+    ASSERT_THROW(grid.with_tile(3, 0, [](auto) {}), std::out_of_range);
+    ASSERT_THROW(grid.with_region({ { 0, 0 }, { 11, 1 } }, [](auto) {}), std::out_of_range);
+}
+
+struct failing_tile_mutex
+{
+    void lock()
+    {
+        if (0 == s_lock_budget)
+        {
+            throw std::runtime_error { "The tile lock failed." };
+        }
+        --s_lock_budget;
+        ++s_locked_count;
+    }
+
+    bool try_lock()
+    {
+        lock();
+        return true;
+    }
+
+    void unlock() noexcept
+    {
+        --s_locked_count;
+    }
+
+    static inline int32_t s_lock_budget = 0;
+    static inline int32_t s_locked_count = 0;
+};
+
+TEST(tiled_array_api_testing, region_lock_failure)
+{
+    ts::tiled_array<int32_t, 2, failing_tile_mutex> grid { { 8, 8 }, { 4, 4 } };
+    failing_tile_mutex::s_lock_budget = 2;
+    ASSERT_THROW(grid.with_region({ { 0, 0 }, { 8, 8 } }, [](auto) {}), std::runtime_error);
+    ASSERT_EQ(failing_tile_mutex::s_locked_count, 0);
+
+    failing_tile_mutex::s_lock_budget = 4;
+    grid.with_region({ { 0, 0 }, { 8, 8 } }, [](auto region) { region(7, 7) = 1; });
+    ASSERT_EQ(failing_tile_mutex::s_locked_count, 0);
+}
+
+TEST(tiled_array_thread_safety_testing, concurrent_overlapping_regions)
+{
+    const auto hardware_concurrency = std::thread::hardware_concurrency() != 0
+            ? std::thread::hardware_concurrency()
+            : 2;
+    constexpr int32_t access_count = 1000;
+    constexpr std::size_t size = 64;
+
+    ts::tiled_array<int32_t, 2, std::mutex> grid { { size, size }, { 8, 8 } };
+    std::vector<std::thread> arr_threads;
+    for (uint32_t i = 0; i < hardware_concurrency; ++i)
+    {
+        arr_threads.emplace_back([&grid, i]()
+        {
+            for (int32_t j = 0; j < access_count; ++j)
+            {
+                const std::size_t first = (i * 7 + static_cast<std::size_t>(j) * 13) % (size - 9);
+                grid.with_region({ { first, first }, { first + 9, first + 9 } }, [](auto region)
+                {
+                    ++region(region.bounds().m_first[0], region.bounds().m_first[1]);
+                    ++region(region.bounds().m_last[0] - 1, region.bounds().m_last[1] - 1);
+                });
+                grid.with_tile(j % 8, i % 8, [](auto tile) { ++tile(0, 0); });
+            }
+        });
+    }
+
+    std::ranges::for_each(arr_threads, std::mem_fn(&std::thread::join));
+
+    int64_t total = 0;
+    grid.with_region({ { 0, 0 }, { size, size } }, [&total](auto region)
+    {
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            for (std::size_t j = 0; j < size; ++j)
+            {
+                total += region(i, j);
+            }
+        }
+    });
+    ASSERT_EQ(total, static_cast<int64_t>(hardware_concurrency) * access_count * 3);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ts::append_buffer testing.
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(append_buffer_api_testing, append_consume_flush)
+{
+    ts::append_buffer log { 64 };
+    ASSERT_EQ(log.capacity(), 64);
+
+    const std::string first = "first";
+    ASSERT_TRUE(log.try_append(std::as_bytes(std::span { first })));
+    ASSERT_TRUE(log.try_append(8, [](std::span<std::byte> record)
+    {
+        const uint64_t value = 13;
+        std::memcpy(record.data(), &value, sizeof(value));
+    }));
+    ASSERT_THROW(log.try_append(4, [](std::span<std::byte>) { throw std::runtime_error { "" }; })
+            , std::runtime_error);
+
+    std::vector<std::size_t> sizes;
+    ASSERT_EQ(log.consume([&sizes](std::span<const std::byte> record)
+    {
+        sizes.push_back(record.size());
+    }), 2);
+    ASSERT_EQ(sizes, (std::vector<std::size_t> { 5, 8 }));
+    ASSERT_EQ(log.consume([](std::span<const std::byte>) {}), 0);
+
+    // 6 of 8 words are used, the record of 24 bytes takes 4 words and does not fit.
+    const std::array<std::byte, 24> large {};
+    ASSERT_FALSE(log.try_append(large));
+    ASSERT_FALSE(log.try_append(std::as_bytes(std::span { first })));
+
+    std::string flushed;
+    ASSERT_EQ(log.flush([](std::span<const std::byte>) {}), 0);
+    ASSERT_TRUE(log.try_append(std::as_bytes(std::span { first })));
+    ASSERT_EQ(log.flush([&flushed](std::span<const std::byte> record)
+    {
+        flushed.assign(reinterpret_cast<const char*>(record.data()), record.size());
+    }), 1);
+    ASSERT_EQ(flushed, first);
+    ASSERT_THROW(ts::append_buffer { 0 }, std::invalid_argument);
+}
+
+TEST(append_buffer_thread_safety_testing, concurrent_append_flush)
+{
+    const auto hardware_concurrency = std::thread::hardware_concurrency() != 0
+            ? std::thread::hardware_concurrency()
+            : 2;
+    constexpr int32_t access_count = 1000;
+
+    ts::append_buffer log { 1024 };
+    std::atomic<int64_t> consumed_sum = 0;
+    std::atomic<int64_t> consumed_count = 0;
+    auto reader = [&consumed_sum, &consumed_count](std::span<const std::byte> record)
+    {
+        int32_t value = 0;
+        ASSERT_EQ(record.size(), sizeof(value));
+        std::memcpy(&value, record.data(), sizeof(value));
+        consumed_sum += value;
+        ++consumed_count;
+    };
+
+    std::vector<std::thread> arr_threads;
+    for (uint32_t i = 0; i < hardware_concurrency; ++i)
+    {
+        arr_threads.emplace_back([&log, &reader]()
+        {
+            for (int32_t j = 0; j < access_count; ++j)
+            {
+                while (!log.try_append(std::as_bytes(std::span { &j, 1 })))
+                {
+                    (void) log.flush(reader);
+                }
+                if (0 == j % 64)
+                {
+                    (void) log.consume(reader);
+                }
+            }
+        });
+    }
+
+    std::ranges::for_each(arr_threads, std::mem_fn(&std::thread::join));
+    (void) log.flush(reader);
+
+    const auto thread_count = static_cast<int64_t>(hardware_concurrency);
+    ASSERT_EQ(consumed_count.load(), access_count * thread_count);
+    ASSERT_EQ(consumed_sum.load(), thread_count * (access_count - 1) * access_count / 2);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ts::thread_pool testing.
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(thread_pool_api_testing, submit)
+{
+    ts::thread_pool pool { 4 };
+    ASSERT_EQ(pool.size(), 4);
+    auto sum = pool.submit([](int32_t a, int32_t b) { return a + b; }, 6, 7);
+    auto str = pool.submit([]() { return std::string { "ts" }; });
+    ASSERT_EQ(sum.get(), 13);
+    ASSERT_EQ(str.get(), "ts");
+
+    auto error = pool.submit([]() { throw std::runtime_error { "error" }; });
+    ASSERT_THROW(error.get(), std::runtime_error);
+}
+
+TEST(thread_pool_api_testing, parallel_for)
+{
+    constexpr int32_t element_count = 10000;
+    ts::thread_pool pool { 4 };
+    auto arr_ptr = ts::make_shared<int32_t[]>(element_count);
+    pool.parallel_for(0, element_count, 128, [&arr_ptr](int32_t i)
+    {
+        (*arr_ptr)[i] = i;
+    });
+    for (int32_t i = 0; i < element_count; ++i)
+    {
+        ASSERT_EQ((*arr_ptr)[i], i);
+    }
+
+    auto throwing = [](int32_t i)
+    {
+        if (i == 42)
+        {
+            throw std::runtime_error { "error" };
+        }
+    };
+    ASSERT_THROW(pool.parallel_for(0, 100, 10, throwing), std::runtime_error);
+}
+
+TEST(thread_pool_api_testing, submit_locked_requeues_busy_task)
+{
+    ts::thread_pool pool { 2 };
+    auto value_ptr = ts::make_shared<int32_t>(0);
+    value_ptr.lock();
+    auto locked = pool.submit_locked(value_ptr, [&value_ptr]() { *(value_ptr.get()) = 13; });
+    auto free = pool.submit([]() { return 42; });
+    ASSERT_EQ(free.get(), 42);
+    ASSERT_EQ(locked.wait_for(std::chrono::milliseconds { 10 }), std::future_status::timeout);
+    value_ptr.unlock();
+    locked.get();
+    ASSERT_EQ(*(value_ptr.get()), 13);
+}
+
+TEST(thread_pool_thread_safety_testing, nested_submit_and_steal)
+{
+    const auto hardware_concurrency = std::thread::hardware_concurrency() != 0
+            ? std::thread::hardware_concurrency()
+            : 2;
+    constexpr int32_t task_count = 1000;
+
+    auto counter_ptr = ts::make_shared<int64_t>(0);
+    std::atomic<int32_t> inner_count { 0 };
+    {
+        ts::thread_pool pool { hardware_concurrency };
+        std::vector<std::future<void>> arr_futures;
+        for (int32_t i = 0; i < task_count; ++i)
+        {
+            arr_futures.push_back(pool.submit([&pool, &counter_ptr, &inner_count]()
+            {
+                pool.parallel_for(0, 10, 1, [&inner_count](int32_t) { ++inner_count; });
+                pool.submit_locked(counter_ptr, [&counter_ptr]() { ++*(counter_ptr.get()); });
+            }));
+        }
+        std::ranges::for_each(arr_futures, std::mem_fn(&std::future<void>::get));
+        ASSERT_EQ(inner_count.load(), task_count * 10);
+    }
+    ASSERT_EQ(*(counter_ptr.get()), task_count);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ts::lock_any testing.
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(lock_any_api_testing, acquires_free_pointer)
+{
+    using t_ptr = ts::shared_ptr<int32_t, ts::notifying_mutex<>>;
+    t_ptr p_first { new int32_t { 0 } };
+    t_ptr p_second { new int32_t { 0 } };
+    p_first.lock();
+    ASSERT_EQ(ts::lock_any(p_first, p_second), 1);
+    ASSERT_FALSE(p_second.try_lock());
+    p_second.unlock();
+    p_first.unlock();
+
+    std::array<t_ptr, 3> shards { t_ptr { new int32_t { 0 } }
+            , t_ptr { new int32_t { 0 } }, t_ptr { new int32_t { 0 } } };
+    shards[0].lock();
+    shards[2].lock();
+    ASSERT_EQ(ts::lock_any(std::span { shards }), 1);
+    for (auto& shard : shards)
+    {
+        shard.unlock();
+    }
+
+    ASSERT_THROW(ts::lock_any(std::span<t_ptr> {}), std::invalid_argument);
+}
+
+TEST(lock_any_api_testing, wakes_on_unlock)
+{
+    ts::unique_ptr<int32_t, ts::notifying_mutex<>> p_first { new int32_t { 0 } };
+    ts::notifying_mutex<> mtx;
+    p_first.lock();
+    mtx.lock();
+    auto index = std::async(std::launch::async, [&p_first, &mtx]()
+    {
+        const std::size_t result = ts::lock_any(p_first, mtx);
+        mtx.unlock();
+        return result;
+    });
+    ASSERT_EQ(index.wait_for(std::chrono::milliseconds { 10 }), std::future_status::timeout);
+    mtx.unlock();
+    ASSERT_EQ(index.get(), 1);
+    p_first.unlock();
+}
+
+TEST(lock_any_thread_safety_testing, workers_serve_any_shard)
+{
+    const auto hardware_concurrency = std::thread::hardware_concurrency() != 0
+            ? std::thread::hardware_concurrency()
+            : 2;
+    const auto thread_count = hardware_concurrency * 2;
+    constexpr int32_t access_count = 1000;
+
+    using t_ptr = ts::shared_ptr<int64_t, ts::notifying_mutex<>>;
+    std::array<t_ptr, 2> shards { t_ptr { new int64_t { 0 } }, t_ptr { new int64_t { 0 } } };
+    std::vector<std::thread> arr_threads;
+    for (uint32_t i = 0; i < thread_count; ++i)
+    {
+        arr_threads.emplace_back([&shards]()
+        {
+            for (int32_t j = 0; j < access_count; ++j)
+            {
+                const std::size_t index = ts::lock_any(std::span { shards });
+                std::unique_lock lock { shards[index], std::adopt_lock };
+                ++*(shards[index].get());
+            }
+        });
+    }
+    std::ranges::for_each(arr_threads, std::mem_fn(&std::thread::join));
+    ASSERT_EQ(*(shards[0].get()) + *(shards[1].get()), int64_t { access_count } * thread_count);
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+
+////////////////////////////////////////////////////////////////////////////////
+// ts::pi_mutex testing.
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(pi_mutex_api_testing, lockable)
+{
+    ts::pi_mutex first;
+    ts::pi_mutex second;
+    {
+        std::scoped_lock lock { first, second };
+        ASSERT_FALSE(first.try_lock());
+        ASSERT_FALSE(second.try_lock());
+    }
+    ASSERT_TRUE(first.try_lock());
+    ASSERT_THROW(first.lock(), std::system_error);
+    first.unlock();
+
+    ts::unique_ptr<std::vector<int32_t>, ts::pi_mutex> p_vec { new std::vector<int32_t> {} };
+    p_vec->push_back(13);
+    ASSERT_EQ(p_vec->size(), 1);
+    ASSERT_EQ(p_vec->front(), 13);
+}
+
+TEST(pi_mutex_thread_safety_testing, concurrent_increment)
+{
+    const auto hardware_concurrency = std::thread::hardware_concurrency() != 0
+            ? std::thread::hardware_concurrency()
+            : 2;
+    const auto thread_count = hardware_concurrency * 2;
+    constexpr int32_t access_count = 1000;
+
+    ts::shared_ptr<int64_t, ts::pi_mutex> p_value { new int64_t { 0 } };
+    std::vector<std::thread> arr_threads;
+    for (uint32_t i = 0; i < thread_count; ++i)
+    {
+        arr_threads.emplace_back([&p_value]()
+        {
+            for (int32_t j = 0; j < access_count; ++j)
+            {
+                std::lock_guard lock { p_value };
+                ++*(p_value.get());
+            }
+        });
+    }
+    std::ranges::for_each(arr_threads, std::mem_fn(&std::thread::join));
+    ASSERT_EQ(*(p_value.get()), int64_t { access_count } * thread_count);
+}
+
+#endif
+
 int main(int argc, char **argv)
 {
-    testing::InitGoogleTest(&argc, argv);
-    return RUN_ALL_TESTS();
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ts::lock_trace_recorder testing.
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(lock_trace_recorder_api_testing, record_save_load_replay)
+{
+    using t_mutex = ts::instrumented_mutex<std::shared_mutex>;
+    ts::shared_ptr<std::vector<int32_t>, t_mutex> p_vec { new std::vector<int32_t> {} };
+    ts::shared_ptr<const std::vector<int32_t>, t_mutex> p_view = p_vec;
+    p_vec->push_back(1);
+
+    ts::lock_trace_recorder recorder;
+    p_vec->push_back(2);
+    ASSERT_EQ(p_view->size(), 2);
+    p_vec.lock();
+    p_vec.unlock();
+    const auto trace = recorder.stop();
+    p_vec->push_back(3);
+
+    ASSERT_EQ(trace.size(), 3);
+    ASSERT_EQ(trace.events()[0].m_mode, ts::impl::access_mode::exclusive);
+    ASSERT_EQ(trace.events()[1].m_mode, ts::impl::access_mode::shared);
+    ASSERT_EQ(trace.events()[0].m_mutex_id, trace.events()[2].m_mutex_id);
+
+    std::stringstream stream;
+    trace.save(stream);
+    const auto loaded = ts::lock_trace::load(stream);
+    ASSERT_TRUE(loaded.has_value());
+    ASSERT_EQ(loaded->size(), 3);
+
+    const auto reports = ts::replay_trace_all<std::mutex, std::shared_mutex>(*loaded);
+    ASSERT_EQ(reports[0].m_acquisition_count, 3);
+    ASSERT_EQ(reports[1].m_acquisition_count, 3);
+    ASSERT_LE(reports[0].m_median_wait, reports[0].m_max_wait);
+
+    std::stringstream invalid_stream { "invalid" };
+    ASSERT_FALSE(ts::lock_trace::load(invalid_stream).has_value());
+
+    std::string truncated = stream.str().substr(0, 16);
+    const std::uint64_t huge_count = std::uint64_t { 1 } << 32;
+    truncated.replace(8, sizeof(huge_count), reinterpret_cast<const char*>(&huge_count)
+            , sizeof(huge_count));
+    std::stringstream truncated_stream { truncated };
+    ASSERT_FALSE(ts::lock_trace::load(truncated_stream).has_value());
+}
+
+TEST(lock_trace_recorder_api_testing, lock_held_across_start)
+{
+    using t_mutex = ts::instrumented_mutex<std::shared_mutex>;
+    ts::shared_ptr<std::vector<int32_t>, t_mutex> p_vec { new std::vector<int32_t> {} };
+    ts::shared_ptr<const std::vector<int32_t>, t_mutex> p_view = p_vec;
+
+    p_view.lock_shared();
+    ts::lock_trace_recorder recorder;
+    p_view.unlock_shared();
+    p_vec.lock();
+    const auto trace = recorder.stop();
+    p_vec.unlock();
+
+    ASSERT_EQ(trace.size(), 0);
+
+    ts::lock_trace_recorder next_recorder;
+    p_vec->push_back(1);
+    ASSERT_EQ(next_recorder.stop().size(), 1);
+}
+
+TEST(lock_trace_recorder_thread_safety_testing, concurrent_record)
+{
+    const auto hardware_concurrency = std::thread::hardware_concurrency() != 0
+            ? std::thread::hardware_concurrency()
+            : 2;
+    constexpr int32_t access_count = 1000;
+
+    ts::unique_ptr<std::vector<int32_t>, ts::instrumented_mutex<>> p_vec {
+        new std::vector<int32_t> {} };
+
+    ts::lock_trace_recorder recorder;
+    std::vector<std::thread> arr_threads;
+    for (uint32_t i = 0; i < hardware_concurrency; ++i)
+    {
+        arr_threads.emplace_back([&p_vec]()
+        {
+            for (int32_t j = 0; j < access_count; ++j)
+            {
+                p_vec->push_back(j);
+            }
+        });
+    }
+
+    std::ranges::for_each(arr_threads, std::mem_fn(&std::thread::join));
+
+    const auto trace = recorder.stop();
+    ASSERT_EQ(trace.size(), static_cast<std::size_t>(hardware_concurrency) * access_count);
+    ASSERT_TRUE(std::ranges::is_sorted(trace.events(), {}
+            , &ts::lock_trace::event_type::m_timestamp_ns));
+    ASSERT_EQ(ts::replay_trace<std::mutex>(trace).m_acquisition_count, trace.size());
+}
+
+TEST(lock_trace_recorder_thread_safety_testing, buffers_of_finished_threads_reused)
+{
+    struct counter_buffer
+    {
+        int32_t m_count = 0;
+    };
+    ts::impl::thread_buffer_pool<counter_buffer> pool {};
+    const auto count_buffers = [&pool]()
+    {
+        std::size_t count = 0;
+        pool.for_each([&count](counter_buffer&) { ++count; });
+        return count;
+    };
+
+    for (int32_t i = 0; i < 4; ++i)
+    {
+        std::thread { [&pool]() { ++pool.local().m_count; } }.join();
+    }
+    ASSERT_EQ(count_buffers(), 1);
+    ASSERT_EQ(pool.at(1)->m_count, 4);
+
+    std::latch both_started { 2 };
+    std::thread first { [&pool, &both_started]()
+    {
+        ++pool.local().m_count;
+        both_started.arrive_and_wait();
+    } };
+    std::thread second { [&pool, &both_started]()
+    {
+        ++pool.local().m_count;
+        both_started.arrive_and_wait();
+    } };
+    first.join();
+    second.join();
+    ASSERT_EQ(count_buffers(), 2);
+    ASSERT_EQ(pool.at(1)->m_count + pool.at(2)->m_count, 6);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ts::cache_line_report testing.
+////////////////////////////////////////////////////////////////////////////////
+
+struct byte_spin_mutex
+{
+    void lock() noexcept
+    {
+        while (m_flag.test_and_set(std::memory_order_acquire))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    void unlock() noexcept
+    {
+        m_flag.clear(std::memory_order_release);
+    }
+
+    bool try_lock() noexcept
+    {
+        return !m_flag.test_and_set(std::memory_order_acquire);
+    }
+
+    std::atomic_flag m_flag {};
+};
+
+template <typename TLockable>
+void contend_once(TLockable& lockable)
+{
+    auto& diagnostics = mutex_diagnostics_of(lockable);
+    const auto contention_count = diagnostics.contention_count();
+    lockable.lock();
+    std::thread waiter { [&lockable]() { lockable.lock(); lockable.unlock(); } };
+    while (diagnostics.contention_count() == contention_count)
+    {
+        std::this_thread::yield();
+    }
+    lockable.unlock();
+    waiter.join();
+}
+
+TEST(cache_line_report_api_testing, co_located_contended_mutexes)
+{
+    using t_mutex = ts::instrumented_mutex<byte_spin_mutex>;
+    struct alignas(64) counters
+    {
+        t_mutex m_orders_mtx {};
+        t_mutex m_stats_mtx {};
+    };
+    static_assert(sizeof(counters) == 64);
+    auto p_counters = std::make_unique<counters>();
+    ts::set_lock_name(p_counters->m_orders_mtx, "orders");
+    ts::set_lock_name(p_counters->m_stats_mtx, "stats");
+
+    ts::unique_ptr<int32_t, t_mutex> p_value { new int32_t { 0 } };
+    ts::set_lock_name(p_value, "value");
+
+    ts::contention_monitor monitor;
+    contend_once(p_counters->m_orders_mtx);
+    contend_once(p_value);
+    auto report = ts::cache_line_report::collect();
+    ASSERT_TRUE(std::ranges::none_of(report.conflicts(), [](const auto& conflict)
+    {
+        return conflict.m_mutexes.front().m_name == "orders";
+    }));
+
+    contend_once(p_counters->m_stats_mtx);
+    contend_once(p_counters->m_stats_mtx);
+    report = ts::cache_line_report::collect();
+    const auto it = std::ranges::find_if(report.conflicts(), [](const auto& conflict)
+    {
+        return conflict.m_mutexes.front().m_name == "orders";
+    });
+    ASSERT_NE(it, report.conflicts().end());
+    ASSERT_EQ(it->m_line_address, reinterpret_cast<std::uintptr_t>(p_counters.get()));
+    ASSERT_EQ(it->m_mutexes.size(), 2);
+    ASSERT_EQ(it->m_mutexes[0].m_contention_count, 1);
+    ASSERT_EQ(it->m_mutexes[1].m_name, "stats");
+    ASSERT_EQ(it->m_mutexes[1].m_contention_count, 2);
+    ASSERT_NE(report.summary().find("[orders x1, stats x2]"), std::string::npos);
+
+    p_counters.reset();
+    ASSERT_EQ(ts::cache_line_report::collect().summary().find("orders"), std::string::npos);
+}
+
+TEST(cache_line_report_api_testing, contended_ranked_mutex)
+{
+    ts::instrumented_mutex<ts::ranked_mutex<std::mutex, 10>> mtx;
+    ts::contention_monitor monitor;
+    contend_once(mtx);
+    ASSERT_EQ(mutex_diagnostics_of(mtx).contention_count(), 1);
+
+    if constexpr (ts::impl::config::s_check_lock_order)
+    {
+        ts::ranked_mutex<std::mutex, 20> outer;
+        std::lock_guard lock { outer };
+        ASSERT_THROW(mtx.lock(), ts::lock_order_exception);
+        ASSERT_TRUE(mtx.try_lock());
+        mtx.unlock();
+    }
+}
+
+TEST(cache_line_report_thread_safety_testing, concurrent_contention)
+{
+    const auto hardware_concurrency = std::thread::hardware_concurrency() != 0
+            ? std::thread::hardware_concurrency()
+            : 2;
+    constexpr int32_t access_count = 1000;
+
+    using t_mutex = ts::instrumented_mutex<byte_spin_mutex>;
+    auto arr_mutexes = std::make_unique<t_mutex[]>(2);
+    int32_t counter = 0;
+    ts::contention_monitor monitor;
+    std::vector<std::thread> arr_threads;
+    for (uint32_t i = 0; i < hardware_concurrency; ++i)
+    {
+        arr_threads.emplace_back([&arr_mutexes, &counter, i]()
+        {
+            for (int32_t j = 0; j < access_count; ++j)
+            {
+                t_mutex local_mutex;
+                ts::set_lock_name(local_mutex, "local");
+                if (0 == i)
+                {
+                    (void) ts::cache_line_report::collect().summary();
+                }
+                for (std::size_t k = 0; k < 2; ++k)
+                {
+                    std::lock_guard lock { arr_mutexes[k] };
+                    ++counter;
+                }
+            }
+        });
+    }
+
+    std::ranges::for_each(arr_threads, std::mem_fn(&std::thread::join));
+
+    ASSERT_EQ(counter, static_cast<int32_t>(hardware_concurrency) * access_count * 2);
+    const auto report = ts::cache_line_report::collect();
+    ASSERT_TRUE(std::ranges::all_of(report.conflicts(), [](const auto& conflict)
+    {
+        return conflict.m_mutexes.size() >= 2 && std::ranges::none_of(conflict.m_mutexes
+                , [](const auto& mtx) { return mtx.m_name == "local"; });
+    }));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ts::footprint_of testing.
+////////////////////////////////////////////////////////////////////////////////
+
+struct footprint_blob
+{
+    std::vector<char> m_data {};
+};
+
+std::size_t footprint_dynamic_size(const footprint_blob& blob)
+{
+    return blob.m_data.capacity();
+}
+
+TEST(footprint_api_testing, shared_and_unique_ptr_accounting)
+{
+    {
+        ts::shared_ptr<footprint_blob> p_shared { new footprint_blob {} };
+        auto p_shared_copy = p_shared;
+        p_shared->m_data.reserve(1000);
+        p_shared.update_footprint();
+
+        ts::unique_ptr<footprint_blob> p_unique { new footprint_blob {} };
+        ts::unique_ptr<footprint_blob> p_moved { std::move(p_unique) };
+        auto p_array = ts::make_shared<footprint_blob[]>(10);
+
+        const auto blob_footprint = ts::footprint_of<footprint_blob>();
+        const auto array_footprint = ts::footprint_of<footprint_blob[]>();
+        if constexpr (ts::impl::config::s_track_footprint)
+        {
+            ASSERT_EQ(blob_footprint.m_live_count, 2);
+            ASSERT_EQ(blob_footprint.m_object_bytes, 2 * sizeof(footprint_blob));
+            ASSERT_EQ(blob_footprint.m_dynamic_bytes, 1000);
+            ASSERT_EQ(blob_footprint.m_mutex_count, 3);
+            ASSERT_GE(blob_footprint.m_mutex_bytes, 3 * sizeof(std::mutex));
+            ASSERT_GT(blob_footprint.m_control_block_bytes, 0);
+            ASSERT_GE(blob_footprint.m_peak_bytes, blob_footprint.total_bytes());
+            ASSERT_EQ(array_footprint.m_live_count, 1);
+            ASSERT_EQ(array_footprint.m_object_bytes, 10 * sizeof(footprint_blob));
+            ASSERT_TRUE(std::ranges::any_of(ts::footprint_report(), [](const auto& entry)
+            {
+                return entry.m_type_name.find("footprint_blob") != std::string::npos;
+            }));
+        }
+        else
+        {
+            ASSERT_EQ(blob_footprint.total_bytes(), 0);
+            ASSERT_EQ(array_footprint.m_live_count, 0);
+        }
+    }
+    const auto blob_footprint = ts::footprint_of<footprint_blob>();
+    ASSERT_EQ(blob_footprint.m_live_count, 0);
+    ASSERT_EQ(blob_footprint.total_bytes(), 0);
+    ASSERT_EQ(ts::footprint_of<footprint_blob[]>().total_bytes(), 0);
+}
+
+TEST(footprint_thread_safety_testing, concurrent_create_reset_move)
+{
+    const auto hardware_concurrency = std::thread::hardware_concurrency() != 0
+            ? std::thread::hardware_concurrency()
+            : 2;
+    constexpr int32_t access_count = 1000;
+
+    auto p_shared = ts::make_shared<footprint_blob>();
+    std::vector<std::thread> arr_threads;
+    for (uint32_t i = 0; i < hardware_concurrency; ++i)
+    {
+        arr_threads.emplace_back([&p_shared]()
+        {
+            for (int32_t j = 0; j < access_count; ++j)
+            {
+                ts::unique_ptr<footprint_blob> p_unique { new footprint_blob {} };
+                p_unique.reset(new footprint_blob {});
+                auto p_copy = p_shared;
+                p_copy.update_footprint();
+                ts::unique_ptr<footprint_blob> p_moved { std::move(p_unique) };
+            }
+        });
+    }
+
+    std::ranges::for_each(arr_threads, std::mem_fn(&std::thread::join));
+
+    const auto blob_footprint = ts::footprint_of<footprint_blob>();
+    if constexpr (ts::impl::config::s_track_footprint)
+    {
+        ASSERT_EQ(blob_footprint.m_live_count, 1);
+        ASSERT_EQ(blob_footprint.m_mutex_count, 1);
+    }
+    else
+    {
+        ASSERT_EQ(blob_footprint.m_live_count, 0);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ts::accounting_scope testing.
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(accounting_scope_api_testing, counts_wait_and_hold)
+{
+    ts::unique_ptr<std::vector<int32_t>, ts::instrumented_mutex<>> p_vec {
+            new std::vector<int32_t> {} };
+    {
+        ts::accounting_scope accounting;
+        p_vec->push_back(1);
+        p_vec->push_back(2);
+        ASSERT_EQ(accounting.acquisition_count(), 2);
+        {
+            ts::accounting_scope nested;
+            std::lock_guard lock { p_vec };
+            std::this_thread::sleep_for(std::chrono::milliseconds { 2 });
+        }
+        ASSERT_EQ(accounting.acquisition_count(), 3);
+        ASSERT_GE(accounting.hold_time(), std::chrono::milliseconds { 2 });
+        ASSERT_GE(accounting.wait_time(), std::chrono::nanoseconds { 0 });
+    }
+
+    p_vec->push_back(3);
+    ts::accounting_scope accounting;
+    ASSERT_EQ(accounting.acquisition_count(), 0);
+    ASSERT_EQ(accounting.hold_time(), std::chrono::nanoseconds { 0 });
+}
+
+TEST(accounting_scope_thread_safety_testing, per_thread_accounting)
+{
+    const auto hardware_concurrency = std::thread::hardware_concurrency() != 0
+            ? std::thread::hardware_concurrency()
+            : 2;
+    constexpr int32_t access_count = 1000;
+
+    ts::shared_ptr<std::vector<int32_t>, ts::instrumented_mutex<>> p_vec {
+            new std::vector<int32_t> {} };
+    std::vector<std::thread> arr_threads;
+    std::atomic<uint64_t> total_count = 0;
+    for (uint32_t i = 0; i < hardware_concurrency; ++i)
+    {
+        arr_threads.emplace_back([&p_vec, &total_count, i]()
+        {
+            ts::accounting_scope accounting;
+            const int32_t count = (0 == i % 2) ? access_count : access_count / 2;
+            for (int32_t j = 0; j < count; ++j)
+            {
+                p_vec->push_back(j);
+            }
+            ASSERT_EQ(accounting.acquisition_count(), static_cast<uint64_t>(count));
+            total_count += accounting.acquisition_count();
+        });
+    }
+
+    std::ranges::for_each(arr_threads, std::mem_fn(&std::thread::join));
+    ASSERT_EQ(p_vec->size(), total_count.load());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ts::lock_sampler testing.
+////////////////////////////////////////////////////////////////////////////////
+
+std::optional<ts::lock_profile_entry> find_profile_entry(const ts::lock_sampler& sampler
+        , const void* p_mutex)
+{
+    for (const auto& entry : sampler.collect())
+    {
+        if (entry.m_mutex_id == reinterpret_cast<std::uintptr_t>(p_mutex))
+        {
+            return entry;
+        }
+    }
+    return std::nullopt;
+}
+
+TEST(lock_sampler_api_testing, sampled_estimates)
+{
+    ts::instrumented_mutex<> mtx;
+    {
+        ts::lock_sampler sampler { 1 };
+        ASSERT_EQ(sampler.period(), 1);
+        for (int32_t i = 0; i < 100; ++i)
+        {
+            std::lock_guard lock { mtx };
+        }
+        const auto entry = find_profile_entry(sampler, &mtx);
+        ASSERT_TRUE(entry.has_value());
+        ASSERT_EQ(entry->m_sample_count, 100);
+        ASSERT_EQ(entry->m_estimated_acquisitions, 100);
+    }
+
+    constexpr int32_t access_count = 16000;
+    ts::lock_sampler sampler { 16 };
+    ASSERT_FALSE(find_profile_entry(sampler, &mtx).has_value());
+    for (int32_t i = 0; i < access_count; ++i)
+    {
+        std::lock_guard lock { mtx };
+    }
+    const auto entry = find_profile_entry(sampler, &mtx);
+    ASSERT_TRUE(entry.has_value());
+    ASSERT_EQ(entry->m_estimated_acquisitions, entry->m_sample_count * 16);
+    ASSERT_GT(entry->m_estimated_acquisitions, access_count * 7 / 10);
+    ASSERT_LT(entry->m_estimated_acquisitions, access_count * 13 / 10);
+}
+
+TEST(lock_sampler_api_testing, sampling_inside_accounting_scope)
+{
+    ts::instrumented_mutex<> mtx;
+    ts::lock_sampler sampler { 1 };
+    {
+        ts::accounting_scope accounting;
+        for (int32_t i = 0; i < 10; ++i)
+        {
+            std::lock_guard lock { mtx };
+        }
+    }
+    const auto entry = find_profile_entry(sampler, &mtx);
+    ASSERT_TRUE(entry.has_value());
+    ASSERT_EQ(entry->m_sample_count, 10);
+}
+
+TEST(lock_sampler_thread_safety_testing, concurrent_sampling)
+{
+    const auto hardware_concurrency = std::thread::hardware_concurrency() != 0
+            ? std::thread::hardware_concurrency()
+            : 2;
+    constexpr int32_t access_count = 1000;
+
+    ts::instrumented_mutex<> mtx;
+    int64_t counter = 0;
+    ts::lock_sampler sampler { 4 };
+    std::vector<std::thread> arr_threads;
+    for (uint32_t i = 0; i < hardware_concurrency; ++i)
+    {
+        arr_threads.emplace_back([&mtx, &counter, &sampler]()
+        {
+            for (int32_t j = 0; j < access_count; ++j)
+            {
+                std::lock_guard lock { mtx };
+                ++counter;
+                if (0 == j % 100)
+                {
+                    (void) sampler.collect();
+                }
+            }
+        });
+    }
+
+    std::ranges::for_each(arr_threads, std::mem_fn(&std::thread::join));
+
+    const auto total = static_cast<uint64_t>(hardware_concurrency) * access_count;
+    ASSERT_EQ(counter, static_cast<int64_t>(total));
+    const auto entry = find_profile_entry(sampler, &mtx);
+    ASSERT_TRUE(entry.has_value());
+    ASSERT_GT(entry->m_estimated_acquisitions, total * 7 / 10);
+    ASSERT_LT(entry->m_estimated_acquisitions, total * 13 / 10);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ts::contention_profiler testing.
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(contention_profiler_api_testing, collapsed_stacks)
+{
+    ts::unique_ptr<int32_t, ts::instrumented_mutex<byte_spin_mutex>> p_value { new int32_t { 0 } };
+    ts::contention_profiler profiler { true };
+    if constexpr (!ts::impl::config::s_profile_contention)
+    {
+        ASSERT_TRUE(profiler.collect().waiters().empty());
+        return;
+    }
+
+    contend_once(p_value);
+    const auto profile = profiler.collect();
+    ASSERT_EQ(profile.waiters().size(), 1);
+    ASSERT_EQ(profile.waiters().front().m_count, 1);
+    ASSERT_FALSE(profile.waiters().front().m_frames.empty());
+    ASSERT_EQ(profile.holders().size(), 1);
+    ASSERT_NE(profile.holders().front().m_frames.front(), "[unknown holder]");
+
+    std::ostringstream waiters;
+    profile.write_collapsed(waiters);
+    const std::string line = waiters.str();
+    ASSERT_NE(line.find(';'), std::string::npos);
+    ASSERT_EQ(line.back(), '\n');
+    ASSERT_EQ(line.substr(line.rfind(' ') + 1)
+            , std::to_string(profile.waiters().front().m_wait.count()) + "\n");
+}
+
+TEST(contention_profiler_thread_safety_testing, concurrent_contention)
+{
+    const auto hardware_concurrency = std::thread::hardware_concurrency() != 0
+            ? std::thread::hardware_concurrency()
+            : 2;
+    constexpr int32_t access_count = 1000;
+
+    ts::shared_ptr<std::vector<int32_t>, ts::instrumented_mutex<>> p_vec {
+            new std::vector<int32_t> {} };
+    ts::contention_profiler profiler {};
+    std::vector<std::thread> arr_threads;
+    for (uint32_t i = 0; i < hardware_concurrency; ++i)
+    {
+        arr_threads.emplace_back([&p_vec]()
+        {
+            for (int32_t j = 0; j < access_count; ++j)
+            {
+                p_vec->push_back(j);
+            }
+        });
+    }
+    if constexpr (ts::impl::config::s_profile_contention)
+    {
+        contend_once(p_vec);
+    }
+
+    std::ranges::for_each(arr_threads, std::mem_fn(&std::thread::join));
+
+    const auto profile = profiler.collect();
+    ASSERT_EQ(profile.waiters().empty(), !ts::impl::config::s_profile_contention);
+    uint64_t count = 0;
+    for (const auto& stack : profile.waiters())
+    {
+        count += stack.m_count;
+    }
+    ASSERT_EQ(count, mutex_diagnostics_of(p_vec).contention_count());
+    ASSERT_TRUE(profile.holders().empty());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ts::shared_ptr range locks testing.
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(range_lock_api_testing, with_range)
+{
+    auto p_buffer = ts::make_shared<int32_t[]>(100);
+    p_buffer.with_range(0, 100, [](std::span<int32_t> range) { std::ranges::fill(range, 0); });
+    p_buffer.with_range(10, 20, [](std::span<int32_t> range)
+    {
+        ASSERT_EQ(range.size(), 10);
+        std::ranges::fill(range, 13);
+    });
+    const auto sum = p_buffer.with_shared_range(0, 100, [](std::span<const int32_t> range)
+    {
+        return std::accumulate(range.begin(), range.end(), 0);
+    });
+    ASSERT_EQ(sum, 130);
+
+    ts::shared_ptr<const int32_t[]> p_const_buffer = p_buffer;
+    p_const_buffer.with_range(15, 16, [](auto range)
+    {
+        static_assert(std::is_same_v<decltype(range), std::span<const int32_t>>);
+        ASSERT_EQ(range[0], 13);
+    });
+
+    p_buffer.with_range(5, 5, [](auto range) { ASSERT_TRUE(range.empty()); });
+    ASSERT_THROW(p_buffer.with_range(6, 5, [](auto) {}), std::out_of_range);
+    ASSERT_THROW(p_buffer.with_range(90, 101, [](auto) {}), std::out_of_range);
+    ASSERT_THROW(p_const_buffer.with_shared_range(100, 101, [](auto) {}), std::out_of_range);
+    p_buffer.with_range(90, 100, [](auto range) { ASSERT_EQ(range.size(), 10); });
+
+    ts::shared_ptr<int32_t[]> p_null {};
+    ASSERT_THROW(p_null.with_range(0, 1, [](auto) {}), ts::null_ptr_exception);
+
+    p_buffer.with_range(0, 1, [&p_buffer](std::span<int32_t> range)
+    {
+        p_buffer.reset();
+        range[0] = 13;
+    });
+    ASSERT_EQ(p_buffer, nullptr);
+}
+
+TEST(range_lock_thread_safety_testing, concurrent_overlapping_ranges)
+{
+    const auto hardware_concurrency = std::thread::hardware_concurrency() != 0
+            ? std::thread::hardware_concurrency()
+            : 2;
+    constexpr int32_t access_count = 1000;
+    constexpr std::size_t size = 256;
+
+    auto p_buffer = ts::make_shared<int32_t[]>(size);
+    p_buffer.with_range(0, size, [](std::span<int32_t> range) { std::ranges::fill(range, 0); });
+    std::vector<std::thread> arr_threads;
+    for (uint32_t i = 0; i < hardware_concurrency; ++i)
+    {
+        arr_threads.emplace_back([&p_buffer, i]()
+        {
+            auto p_local = p_buffer;
+            for (int32_t j = 0; j < access_count; ++j)
+            {
+                const std::size_t begin = (i * 31 + static_cast<std::size_t>(j) * 17) % (size - 32);
+                p_local.with_range(begin, begin + 32, [](std::span<int32_t> range)
+                {
+                    for (int32_t& value : range)
+                    {
+                        ++value;
+                    }
+                });
+                (void) p_local.with_shared_range(begin, begin + 8, [](auto range)
+                {
+                    return range.front();
+                });
+            }
+        });
+    }
+
+    std::ranges::for_each(arr_threads, std::mem_fn(&std::thread::join));
+
+    const auto sum = p_buffer.with_shared_range(0, size, [](auto range)
+    {
+        return std::accumulate(range.begin(), range.end(), int64_t { 0 });
+    });
+    ASSERT_EQ(sum, static_cast<int64_t>(hardware_concurrency) * access_count * 32);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ts::shared_ptr and ts::unique_ptr file I/O testing.
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(file_io_api_testing, write_to_read_from)
+{
+    std::FILE* p_file = std::tmpfile();
+    ASSERT_NE(p_file, nullptr);
+    const int fd = fileno(p_file);
+
+    auto p_source = ts::make_shared<std::byte[]>(64);
+    p_source.with_range(0, 64, [](std::span<std::byte> bytes)
+    {
+        for (std::size_t i = 0; i < bytes.size(); ++i)
+        {
+            bytes[i] = static_cast<std::byte>(i);
+        }
+    });
+    ASSERT_EQ(p_source.write_to(fd, 0, 0, 64), 64);
+    ASSERT_EQ(p_source.write_to(fd, 64, 16, 32), 16);
+
+    auto p_target = ts::make_unique<std::byte[]>(80);
+    ASSERT_EQ(p_target.read_from(fd, 0, 0, 80), 80);
+    ASSERT_EQ((*p_target)[63], std::byte { 63 });
+    ASSERT_EQ((*p_target)[64], std::byte { 16 });
+    ASSERT_EQ((*p_target)[79], std::byte { 31 });
+    ASSERT_EQ(p_target.read_from(fd, 70, 0, 80), 10);
+    ASSERT_EQ(p_target.write_to(fd, 80, 0, 0), 0);
+
+    ASSERT_THROW(p_source.write_to(fd, 0, 2, 1), std::out_of_range);
+    ASSERT_THROW(p_source.write_to(fd, 0, 0, 65), std::out_of_range);
+    ASSERT_THROW(p_source.read_from(fd, 0, 60, 65), std::out_of_range);
+    ASSERT_THROW(p_target.read_from(fd, 0, 0, 81), std::out_of_range);
+    auto p_moved = std::move(p_target);
+    ASSERT_THROW(p_moved.write_to(fd, 0, 80, 81), std::out_of_range);
+    ASSERT_THROW(p_source.write_to(-1, 0, 0, 1), std::system_error);
+    ts::shared_ptr<std::byte[]> p_null {};
+    ASSERT_THROW(p_null.write_to(fd, 0, 0, 1), ts::null_ptr_exception);
+    std::fclose(p_file);
 }
 
+TEST(file_io_thread_safety_testing, concurrent_write_to_async)
+{
+    const auto hardware_concurrency = std::thread::hardware_concurrency() != 0
+            ? std::thread::hardware_concurrency()
+            : 2;
+    constexpr int32_t access_count = 1000;
+    constexpr std::size_t block_size = 16;
+
+    std::FILE* p_file = std::tmpfile();
+    ASSERT_NE(p_file, nullptr);
+    const int fd = fileno(p_file);
+
+    ts::thread_pool pool {};
+    auto p_buffer = ts::make_shared<int32_t[]>(hardware_concurrency * block_size);
+    std::vector<std::thread> arr_threads;
+    for (uint32_t i = 0; i < hardware_concurrency; ++i)
+    {
+        arr_threads.emplace_back([&pool, &p_buffer, fd, i]()
+        {
+            const std::size_t begin = i * block_size;
+            for (int32_t j = 0; j < access_count; ++j)
+            {
+                for (std::size_t k = begin; k < begin + block_size; ++k)
+                {
+                    (*p_buffer)[k] = j;
+                }
+                const auto written = p_buffer.write_to_async(pool, fd, begin * sizeof(int32_t)
+                        , begin, begin + block_size).get();
+                ASSERT_EQ(written, block_size * sizeof(int32_t));
+            }
+        });
+    }
+
+    std::ranges::for_each(arr_threads, std::mem_fn(&std::thread::join));
+
+    auto p_result = ts::make_unique<int32_t[]>(hardware_concurrency * block_size);
+    ASSERT_EQ(p_result.read_from_async(pool, fd, 0, 0, hardware_concurrency * block_size).get()
+            , hardware_concurrency * block_size * sizeof(int32_t));
+    for (std::size_t k = 0; k < hardware_concurrency * block_size; ++k)
+    {
+        ASSERT_EQ((*p_result)[k], access_count - 1);
+    }
+    std::fclose(p_file);
+}
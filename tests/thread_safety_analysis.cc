@@ -0,0 +1,68 @@
+/**
+ * @file        thread_safety_analysis.cc
+ * @author      Argishti Ayvazyan (ayvazyan.argishti@gmail.com)
+ * @brief       The compile check of the Clang thread safety analysis of the pointers.
+ * @date        10/19/2026.
+ * @copyright   Copyright (c) 2026
+ *
+ * Compiled by tests/CMakeLists.txt with -Wthread-safety -Werror. TS_ANALYSIS_CASE 0 accesses
+ * the objects under the locks and should compile, the other cases access them without the
+ * required lock and should be rejected.
+ */
+
+#include <mutex>
+#include <shared_mutex>
+
+#include <ts_memory.h>
+
+using t_counter_ptr = ts::unique_ptr<int>;
+using t_shared_counter_ptr = ts::shared_ptr<int, std::shared_mutex>;
+using t_const_counter_ptr = ts::shared_ptr<const int, std::shared_mutex>;
+
+void increment(const t_counter_ptr& p_counter) TS_REQUIRES(p_counter)
+{
+    ++(*p_counter.get());
+}
+
+int read(const t_const_counter_ptr& p_counter) TS_REQUIRES_SHARED(p_counter)
+{
+    return *p_counter.get();
+}
+
+int read_exclusive(const t_const_counter_ptr& p_counter) TS_REQUIRES(p_counter)
+{
+    return *p_counter.get();
+}
+
+int check_analysis(t_counter_ptr& p_counter, const t_const_counter_ptr& p_const_counter)
+{
+#if TS_ANALYSIS_CASE == 0
+    p_counter.lock();
+    increment(p_counter);
+    p_counter.unlock();
+    if (p_counter.try_lock())
+    {
+        increment(p_counter);
+        p_counter.unlock();
+    }
+    p_const_counter.lock_shared();
+    const int value = read(p_const_counter);
+    p_const_counter.unlock_shared();
+    ts::lock_token token { p_const_counter };
+    return value + read(p_const_counter);
+#elif TS_ANALYSIS_CASE == 1
+    // The unique pointer is not locked.
+    (void) p_const_counter;
+    increment(p_counter);
+    return 0;
+#elif TS_ANALYSIS_CASE == 2
+    // The token of the read-only pointer is shared.
+    (void) p_counter;
+    ts::lock_token token { p_const_counter };
+    return read_exclusive(p_const_counter);
+#elif TS_ANALYSIS_CASE == 3
+    // The read-only pointer is not locked.
+    (void) p_counter;
+    return read(p_const_counter);
+#endif
+}